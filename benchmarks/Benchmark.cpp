@@ -0,0 +1,214 @@
+#include "Benchmark.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <ctime>
+#include <numeric>
+#include <ostream>
+#include <utility>
+
+#include "precice/impl/versions.hpp"
+#include "utils/assertion.hpp"
+#include "utils/fmt.hpp"
+
+namespace precice::benchmarks {
+
+namespace {
+
+std::vector<Benchmark> &registry()
+{
+  static std::vector<Benchmark> benchmarks;
+  return benchmarks;
+}
+
+/// Quotes and escapes a string for JSON
+std::string quoted(const std::string &str)
+{
+  std::string result{'"'};
+  for (char c : str) {
+    if (c == '"' || c == '\\') {
+      result.push_back('\\');
+    }
+    result.push_back(c);
+  }
+  result.push_back('"');
+  return result;
+}
+
+std::string currentDate()
+{
+  const std::time_t now = std::time(nullptr);
+  char              buffer[32];
+  std::strftime(buffer, sizeof(buffer), "%Y-%m-%dT%H:%M:%S", std::localtime(&now));
+  return buffer;
+}
+
+} // namespace
+
+State::State(std::string name, const Options &options)
+    : _name(std::move(name)), _options(options)
+{
+}
+
+const std::string &State::name() const
+{
+  return _name;
+}
+
+const Options &State::options() const
+{
+  return _options;
+}
+
+void State::setParameter(const std::string &key, const std::string &value)
+{
+  _parameters[key] = value;
+}
+
+void State::setParameter(const std::string &key, long value)
+{
+  _parameters[key] = std::to_string(value);
+}
+
+void State::measure(const std::string &phase, const std::function<void()> &setup, const std::function<void()> &body, double items)
+{
+  using Clock = std::chrono::steady_clock;
+
+  Measurement measurement{_name, phase, _parameters, {}, items};
+  measurement.seconds.reserve(_options.repetitions);
+
+  for (int repetition = 0; repetition < _options.warmup + _options.repetitions; ++repetition) {
+    setup();
+    const auto start = Clock::now();
+    body();
+    const auto stop = Clock::now();
+    if (repetition >= _options.warmup) {
+      measurement.seconds.push_back(std::chrono::duration<double>(stop - start).count());
+    }
+  }
+  _measurements.push_back(std::move(measurement));
+}
+
+void State::measure(const std::string &phase, const std::function<void()> &body, double items)
+{
+  measure(phase, [] {}, body, items);
+}
+
+void State::record(const std::string &phase, std::vector<double> seconds, double items)
+{
+  PRECICE_ASSERT(!seconds.empty(), phase);
+  _measurements.push_back(Measurement{_name, phase, _parameters, std::move(seconds), items});
+}
+
+const std::vector<Measurement> &State::measurements() const
+{
+  return _measurements;
+}
+
+void registerBenchmark(std::string name, BenchmarkFunction function, bool parallel)
+{
+  auto &benchmarks = registry();
+  PRECICE_ASSERT(std::none_of(benchmarks.begin(), benchmarks.end(), [&name](const auto &b) { return b.name == name; }),
+                 "Benchmark registered twice", name);
+  auto pos = std::upper_bound(benchmarks.begin(), benchmarks.end(), name, [](const auto &n, const auto &b) { return n < b.name; });
+  benchmarks.insert(pos, Benchmark{std::move(name), std::move(function), parallel});
+}
+
+const std::vector<Benchmark> &registeredBenchmarks()
+{
+  return registry();
+}
+
+void writeJSON(std::ostream &out, const Options &options, int ranks, const std::vector<Measurement> &measurements)
+{
+  fmt::print(out,
+             R"({{
+  "context": {{
+    "version": "{}",
+    "revision": {},
+    "date": "{}",
+    "assertions": {},
+    "ranks": {},
+    "vertices": {},
+    "repetitions": {},
+    "warmup": {},
+    "fields": {},
+    "substeps": {},
+    "time-windows": {},
+    "m2n": {}
+  }},
+  "benchmarks": [)",
+             PRECICE_VERSION,
+             quoted(precice::preciceRevision),
+             currentDate(),
+#ifdef NDEBUG
+             false,
+#else
+             true,
+#endif
+             ranks,
+             options.vertices,
+             options.repetitions,
+             options.warmup,
+             options.fields,
+             options.substeps,
+             options.timeWindows,
+             quoted(options.m2n));
+
+  bool first = true;
+  for (const auto &m : measurements) {
+    std::vector<double> sorted = m.seconds;
+    std::sort(sorted.begin(), sorted.end());
+    const auto   n      = static_cast<double>(sorted.size());
+    const double mean   = std::accumulate(sorted.begin(), sorted.end(), 0.0) / n;
+    const auto   mid    = sorted.size() / 2;
+    const double median = (sorted.size() % 2 == 1) ? sorted[mid] : 0.5 * (sorted[mid - 1] + sorted[mid]);
+    double       sq     = 0.0;
+    for (double s : sorted) {
+      sq += (s - mean) * (s - mean);
+    }
+    const double stddev = sorted.size() > 1 ? std::sqrt(sq / (n - 1)) : 0.0;
+
+    std::string throughput;
+    if (m.items > 0) {
+      throughput = fmt::format(R"(,
+      "items": {},
+      "throughput": {:.9e})",
+                               m.items, m.items / median);
+    }
+
+    std::string parameters;
+    for (const auto &[key, value] : m.parameters) {
+      parameters += fmt::format("{}{}: {}", parameters.empty() ? "" : ", ", quoted(key), quoted(value));
+    }
+
+    fmt::print(out,
+               R"({}
+    {{
+      "name": {},
+      "phase": {},
+      "parameters": {{{}}},
+      "repetitions": {},
+      "min": {:.9e},
+      "median": {:.9e},
+      "mean": {:.9e},
+      "max": {:.9e},
+      "stddev": {:.9e}{}
+    }})",
+               first ? "" : ",",
+               quoted(m.name),
+               quoted(m.phase),
+               parameters,
+               sorted.size(),
+               sorted.front(),
+               median,
+               mean,
+               sorted.back(),
+               stddev,
+               throughput);
+    first = false;
+  }
+  out << "\n  ]\n}\n";
+}
+
+} // namespace precice::benchmarks
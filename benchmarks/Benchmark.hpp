@@ -0,0 +1,138 @@
+#pragma once
+
+#include <functional>
+#include <iosfwd>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace precice {
+namespace benchmarks {
+
+/// Directory for the connection information and other files of the parallel benchmarks
+inline constexpr const char *runDirectory = "precice-bench-run";
+
+/// Options of a benchmark run, which are set on the command line
+struct Options {
+  /// Approximate number of vertices of the generated input meshes
+  int vertices = 1000;
+
+  /// Number of timed repetitions of every phase
+  int repetitions = 5;
+
+  /// Number of untimed repetitions of every phase before the timed ones
+  int warmup = 1;
+
+  /// @name Options of the coupling benchmarks
+  /// @{
+
+  /// Number of data fields written by every participant
+  int fields = 2;
+
+  /// Number of substeps per time window
+  int substeps = 1;
+
+  /// Number of time windows per coupled run
+  int timeWindows = 10;
+
+  /// The m2n type to use
+  std::string m2n = "sockets";
+  /// @}
+};
+
+/// All timings of a single phase of a benchmark
+struct Measurement {
+  std::string                        name;
+  std::string                        phase;
+  std::map<std::string, std::string> parameters;
+  std::vector<double>                seconds;
+  /// Amount of processed items per repetition, such as coupled degrees of freedom, used to report a throughput
+  double items = 0;
+};
+
+/**
+ * @brief Handed to every benchmark to time its phases.
+ *
+ * A benchmark prepares its data and then calls measure() for every phase it wants to time.
+ * Every phase is executed warmup + repetitions times, of which only the last repetitions are recorded.
+ */
+class State {
+public:
+  State(std::string name, const Options &options);
+
+  const std::string &name() const;
+
+  const Options &options() const;
+
+  /// Records a parameter, which is reported with all phases measured afterwards
+  void setParameter(const std::string &key, const std::string &value);
+
+  /// @copydoc setParameter
+  void setParameter(const std::string &key, long value);
+
+  /**
+   * @brief Times a phase of the benchmark.
+   *
+   * @param[in] phase name of the phase
+   * @param[in] setup prepares every repetition of the phase, not timed
+   * @param[in] body the timed work of the phase
+   * @param[in] items amount of processed items per repetition, which is reported as throughput if positive
+   */
+  void measure(const std::string &phase, const std::function<void()> &setup, const std::function<void()> &body, double items = 0);
+
+  /// Times a phase of the benchmark, which requires no setup
+  void measure(const std::string &phase, const std::function<void()> &body, double items = 0);
+
+  /**
+   * @brief Records timings of a phase, which were measured by the benchmark itself.
+   *
+   * This is useful for phases, which cannot be repeated in isolation, such as the steps of a coupled simulation.
+   * The benchmark is responsible for excluding the warmup.
+   *
+   * @param[in] phase name of the phase
+   * @param[in] seconds the timings of the phase
+   * @param[in] items amount of processed items per timing, which is reported as throughput if positive
+   */
+  void record(const std::string &phase, std::vector<double> seconds, double items = 0);
+
+  const std::vector<Measurement> &measurements() const;
+
+private:
+  std::string _name;
+
+  const Options &_options;
+
+  std::map<std::string, std::string> _parameters;
+
+  std::vector<Measurement> _measurements;
+};
+
+using BenchmarkFunction = std::function<void(State &)>;
+
+struct Benchmark {
+  std::string       name;
+  BenchmarkFunction function;
+  /// Parallel benchmarks run on all MPI ranks and require at least two, serial benchmarks run on the primary rank only
+  bool parallel;
+};
+
+/// Adds a benchmark to the list of available benchmarks
+void registerBenchmark(std::string name, BenchmarkFunction function, bool parallel = false);
+
+/// Returns all registered benchmarks sorted by their name
+const std::vector<Benchmark> &registeredBenchmarks();
+
+/// Writes the measurements including their statistics and some context information as JSON
+void writeJSON(std::ostream &out, const Options &options, int ranks, const std::vector<Measurement> &measurements);
+
+/// @name Registration functions of the benchmark suites
+/// @{
+void registerCommunicationBenchmarks();
+void registerCouplingBenchmarks();
+void registerMeshBenchmarks();
+void registerMappingBenchmarks();
+void registerQueryBenchmarks();
+/// @}
+
+} // namespace benchmarks
+} // namespace precice
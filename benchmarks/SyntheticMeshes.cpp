@@ -0,0 +1,173 @@
+#include "SyntheticMeshes.hpp"
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+#include "math/constants.hpp"
+#include "mesh/Mesh.hpp"
+#include "utils/assertion.hpp"
+
+namespace precice::benchmarks {
+
+int surfaceVerticesPerEdge(int vertices)
+{
+  return std::max(3, static_cast<int>(std::lround(std::sqrt(vertices))));
+}
+
+int volumeVerticesPerEdge(int vertices)
+{
+  return std::max(3, static_cast<int>(std::lround(std::cbrt(vertices))));
+}
+
+std::vector<double> surfaceCoordinates(int verticesPerEdge, int rank, int size)
+{
+  PRECICE_ASSERT(verticesPerEdge > 1);
+  PRECICE_ASSERT(rank >= 0 && rank < size, rank, size);
+  const int    n     = verticesPerEdge;
+  const double h     = 1.0 / (n - 1);
+  const int    begin = (n * rank) / size;
+  const int    end   = (n * (rank + 1)) / size;
+
+  std::vector<double> coordinates;
+  coordinates.reserve(3 * n * (end - begin));
+  for (int j = begin; j < end; ++j) {
+    for (int i = 0; i < n; ++i) {
+      const double x = i * h;
+      const double y = j * h;
+      coordinates.insert(coordinates.end(), {x, y, 0.1 * std::sin(2 * math::PI * x) * std::cos(2 * math::PI * y)});
+    }
+  }
+  return coordinates;
+}
+
+std::vector<int> surfaceTriangles(int verticesPerEdge)
+{
+  const int n = verticesPerEdge;
+
+  std::vector<int> triangles;
+  triangles.reserve(6 * (n - 1) * (n - 1));
+  for (int j = 0; j < n - 1; ++j) {
+    for (int i = 0; i < n - 1; ++i) {
+      const int v00 = i + n * j;
+      const int v10 = v00 + 1;
+      const int v01 = v00 + n;
+      const int v11 = v01 + 1;
+      triangles.insert(triangles.end(), {v00, v10, v11, v00, v11, v01});
+    }
+  }
+  return triangles;
+}
+
+std::vector<double> volumeCoordinates(int verticesPerEdge, double lower, double upper)
+{
+  PRECICE_ASSERT(verticesPerEdge > 1);
+  const int    n = verticesPerEdge;
+  const double h = (upper - lower) / (n - 1);
+
+  std::vector<double> coordinates;
+  coordinates.reserve(3 * static_cast<std::size_t>(n) * n * n);
+  for (int k = 0; k < n; ++k) {
+    for (int j = 0; j < n; ++j) {
+      for (int i = 0; i < n; ++i) {
+        coordinates.insert(coordinates.end(), {lower + i * h, lower + j * h, lower + k * h});
+      }
+    }
+  }
+  return coordinates;
+}
+
+std::vector<int> volumeTetrahedra(int verticesPerEdge)
+{
+  const int n = verticesPerEdge;
+
+  // Kuhn subdivision: every permutation of the axes defines a path from the lowest
+  // to the highest corner of a cell, which spans one of its six tetrahedra
+  constexpr std::array<std::array<int, 3>, 6> permutations{{{0, 1, 2}, {0, 2, 1}, {1, 0, 2}, {1, 2, 0}, {2, 0, 1}, {2, 1, 0}}};
+  const std::array<int, 3>                    strides{1, n, n * n};
+
+  std::vector<int> tetrahedra;
+  tetrahedra.reserve(24 * static_cast<std::size_t>(n - 1) * (n - 1) * (n - 1));
+  for (int k = 0; k < n - 1; ++k) {
+    for (int j = 0; j < n - 1; ++j) {
+      for (int i = 0; i < n - 1; ++i) {
+        const int corner = i + n * (j + n * k);
+        for (const auto &p : permutations) {
+          const int a = corner;
+          const int b = a + strides[p[0]];
+          const int c = b + strides[p[1]];
+          const int d = c + strides[p[2]];
+          tetrahedra.insert(tetrahedra.end(), {a, b, c, d});
+        }
+      }
+    }
+  }
+  return tetrahedra;
+}
+
+void fillSurfaceMesh(mesh::Mesh &mesh, int verticesPerEdge, Connectivity connectivity)
+{
+  PRECICE_ASSERT(mesh.getDimensions() == 3);
+
+  const auto coordinates = surfaceCoordinates(verticesPerEdge);
+  for (std::size_t i = 0; i < coordinates.size(); i += 3) {
+    mesh.createVertex(Eigen::Vector3d(coordinates[i], coordinates[i + 1], coordinates[i + 2]));
+  }
+
+  if (connectivity == Connectivity::None) {
+    return;
+  }
+
+  auto &     vertices  = mesh.vertices();
+  const auto triangles = surfaceTriangles(verticesPerEdge);
+  for (std::size_t i = 0; i < triangles.size(); i += 3) {
+    auto &a = vertices[triangles[i]];
+    auto &b = vertices[triangles[i + 1]];
+    auto &c = vertices[triangles[i + 2]];
+    if (connectivity == Connectivity::Explicit) {
+      mesh.createTriangle(mesh.createEdge(a, b), mesh.createEdge(b, c), mesh.createEdge(c, a));
+    } else {
+      mesh.createTriangle(a, b, c);
+    }
+  }
+}
+
+void fillVolumeMesh(mesh::Mesh &mesh, int verticesPerEdge, double lower, double upper, Connectivity connectivity)
+{
+  PRECICE_ASSERT(mesh.getDimensions() == 3);
+  PRECICE_ASSERT(connectivity != Connectivity::Explicit);
+
+  const auto coordinates = volumeCoordinates(verticesPerEdge, lower, upper);
+  for (std::size_t i = 0; i < coordinates.size(); i += 3) {
+    mesh.createVertex(Eigen::Vector3d(coordinates[i], coordinates[i + 1], coordinates[i + 2]));
+  }
+
+  if (connectivity == Connectivity::None) {
+    return;
+  }
+
+  auto &     vertices   = mesh.vertices();
+  const auto tetrahedra = volumeTetrahedra(verticesPerEdge);
+  for (std::size_t i = 0; i < tetrahedra.size(); i += 4) {
+    mesh.createTetrahedron(vertices[tetrahedra[i]], vertices[tetrahedra[i + 1]], vertices[tetrahedra[i + 2]], vertices[tetrahedra[i + 3]]);
+  }
+}
+
+Eigen::VectorXd evaluateTestFunction(const mesh::Mesh &mesh)
+{
+  Eigen::VectorXd values(mesh.nVertices());
+  for (const auto &v : mesh.vertices()) {
+    values(v.getID()) = std::sin(v.coord(0)) + std::cos(v.coord(1)) + v.coord(0) * v.coord(2);
+  }
+  return values;
+}
+
+Eigen::MatrixXd evaluateTestGradient(const mesh::Mesh &mesh)
+{
+  Eigen::MatrixXd gradients(3, mesh.nVertices());
+  for (const auto &v : mesh.vertices()) {
+    gradients.col(v.getID()) << std::cos(v.coord(0)) + v.coord(2), -std::sin(v.coord(1)), v.coord(0);
+  }
+  return gradients;
+}
+
+} // namespace precice::benchmarks
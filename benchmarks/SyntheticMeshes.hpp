@@ -0,0 +1,75 @@
+#pragma once
+
+#include <Eigen/Core>
+#include <vector>
+
+namespace precice {
+namespace mesh {
+class Mesh;
+}
+
+namespace benchmarks {
+
+/// Which connectivity to create for a synthetic mesh
+enum class Connectivity {
+  /// Vertices only
+  None,
+  /// Triangles or tetrahedra defined by their vertices
+  Implicit,
+  /** Triangles defined by three explicitly created edges.
+   *
+   * Edges shared by neighboring triangles are created twice, as done by adapters iterating over faces.
+   */
+  Explicit
+};
+
+/// Returns the vertices per edge of a square surface mesh with about the given amount of vertices
+int surfaceVerticesPerEdge(int vertices);
+
+/// Returns the vertices per edge of a cube volume mesh with about the given amount of vertices
+int volumeVerticesPerEdge(int vertices);
+
+/**
+ * @brief Returns the coordinates of a curved surface patch over the unit square.
+ *
+ * The patch z = 0.1 sin(2 pi x) cos(2 pi y) is sampled by a regular grid of verticesPerEdge^2 vertices.
+ * The rows of the grid are distributed evenly over \p size ranks, of which the rows of \p rank are returned.
+ *
+ * @returns the coordinates in the layout of Participant::setMeshVertices()
+ */
+std::vector<double> surfaceCoordinates(int verticesPerEdge, int rank = 0, int size = 1);
+
+/// Returns the vertex IDs of the triangles of the surface patch with verticesPerEdge^2 vertices, three per triangle
+std::vector<int> surfaceTriangles(int verticesPerEdge);
+
+/// Returns the coordinates of a regular grid of verticesPerEdge^3 vertices in the cube [lower, upper]^3
+std::vector<double> volumeCoordinates(int verticesPerEdge, double lower, double upper);
+
+/// Returns the vertex IDs of the tetrahedra of the cube with verticesPerEdge^3 vertices, four per tetrahedron
+std::vector<int> volumeTetrahedra(int verticesPerEdge);
+
+/**
+ * @brief Fills a 3D mesh with a curved surface patch over the unit square.
+ *
+ * The patch z = 0.1 sin(2 pi x) cos(2 pi y) is sampled by a regular grid
+ * of verticesPerEdge^2 vertices. Every grid cell is split into two triangles.
+ */
+void fillSurfaceMesh(mesh::Mesh &mesh, int verticesPerEdge, Connectivity connectivity);
+
+/**
+ * @brief Fills a 3D mesh with the cube [lower, upper]^3.
+ *
+ * The cube is sampled by a regular grid of verticesPerEdge^3 vertices.
+ * Every grid cell is split into six tetrahedra.
+ * Explicit connectivity is not supported for volume meshes.
+ */
+void fillVolumeMesh(mesh::Mesh &mesh, int verticesPerEdge, double lower, double upper, Connectivity connectivity);
+
+/// Evaluates a smooth scalar test function at all vertices of the mesh
+Eigen::VectorXd evaluateTestFunction(const mesh::Mesh &mesh);
+
+/// Evaluates the gradient of the test function at all vertices of the mesh
+Eigen::MatrixXd evaluateTestGradient(const mesh::Mesh &mesh);
+
+} // namespace benchmarks
+} // namespace precice
@@ -0,0 +1,15 @@
+#
+# This file lists all benchmark sources that will be compiled into the benchmark executable
+#
+target_sources(precice-bench
+    PRIVATE
+    benchmarks/Benchmark.cpp
+    benchmarks/Benchmark.hpp
+    benchmarks/SyntheticMeshes.cpp
+    benchmarks/SyntheticMeshes.hpp
+    benchmarks/com/CommunicationBenchmarks.cpp
+    benchmarks/coupling/CouplingBenchmarks.cpp
+    benchmarks/mapping/MappingBenchmarks.cpp
+    benchmarks/mesh/MeshBenchmarks.cpp
+    benchmarks/query/QueryBenchmarks.cpp
+    )
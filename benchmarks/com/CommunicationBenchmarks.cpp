@@ -0,0 +1,358 @@
+#ifndef PRECICE_NO_MPI
+
+#include <algorithm>
+#include <cmath>
+#include <filesystem>
+#include <map>
+#include <memory>
+#include <mpi.h>
+#include <string>
+#include <vector>
+
+#include "Benchmark.hpp"
+#include "com/Communication.hpp"
+#include "com/MPIDirectCommunication.hpp"
+#include "com/MPIPortsCommunicationFactory.hpp"
+#include "com/MPISinglePortsCommunicationFactory.hpp"
+#include "com/Request.hpp"
+#include "com/SharedPointer.hpp"
+#include "com/SocketCommunicationFactory.hpp"
+#include "m2n/GatherScatterComFactory.hpp"
+#include "m2n/M2N.hpp"
+#include "m2n/PointToPointComFactory.hpp"
+#include "mesh/Mesh.hpp"
+#include "utils/IntraComm.hpp"
+#include "utils/Parallel.hpp"
+#include "utils/assertion.hpp"
+
+namespace precice::benchmarks {
+
+namespace {
+
+/// The inter-participant communication backends, named like their m2n tags
+std::vector<std::string> interParticipantBackends()
+{
+  // MPI ports are unreliable with these implementations, see the warnings of the M2NConfiguration
+#if defined(OMPI_MAJOR_VERSION) || defined(I_MPI_VERSION)
+  return {"sockets"};
+#else
+  return {"sockets", "mpi", "mpi-multiple-ports"};
+#endif
+}
+
+com::PtrCommunicationFactory createCommunicationFactory(const std::string &backend)
+{
+  if (backend == "sockets") {
+    return std::make_shared<com::SocketCommunicationFactory>(std::string(runDirectory));
+  }
+  if (backend == "mpi") {
+    return std::make_shared<com::MPISinglePortsCommunicationFactory>(runDirectory);
+  }
+  PRECICE_ASSERT(backend == "mpi-multiple-ports", backend);
+  return std::make_shared<com::MPIPortsCommunicationFactory>(runDirectory);
+}
+
+/**
+ * @brief Sets up the MPI communicator of a group of ranks like a participant does.
+ *
+ * The ranks of MPI_COMM_WORLD with the same color form a group, the others are excluded.
+ * While the group is alive, it is the current communicator of utils::Parallel.
+ */
+class RankGroup {
+public:
+  explicit RankGroup(int color)
+  {
+    int worldRank;
+    MPI_Comm_rank(MPI_COMM_WORLD, &worldRank);
+    MPI_Comm_split(MPI_COMM_WORLD, color, worldRank, &_comm);
+    if (_comm != MPI_COMM_NULL) {
+      MPI_Comm_rank(_comm, &_rank);
+      MPI_Comm_size(_comm, &_size);
+      utils::Parallel::initializeOrDetectMPI(_comm);
+      // Another group may create the directory concurrently
+      std::error_code ec;
+      std::filesystem::create_directories(runDirectory, ec);
+    }
+  }
+
+  ~RankGroup()
+  {
+    if (_comm != MPI_COMM_NULL) {
+      utils::Parallel::finalizeOrCleanupMPI();
+      MPI_Comm_free(&_comm);
+    }
+  }
+
+  bool contains() const
+  {
+    return _comm != MPI_COMM_NULL;
+  }
+
+  int rank() const
+  {
+    return _rank;
+  }
+
+  int size() const
+  {
+    return _size;
+  }
+
+private:
+  MPI_Comm _comm = MPI_COMM_NULL;
+  int      _rank = 0;
+  int      _size = 0;
+};
+
+/// Keeps the core busy to measure how well a transfer overlaps with computations
+void compute(std::vector<double> &values)
+{
+  for (auto &value : values) {
+    value = std::sqrt(value + 1.0);
+  }
+}
+
+/**
+ * @brief Measures latency, message rate, bandwidth, and overlap of a communication between two ranks.
+ *
+ * The first two ranks of MPI_COMM_WORLD take part, where rank 0 sends and measures.
+ * Every phase ends with an acknowledgement, such that the timings cover the complete transfer.
+ */
+void benchmarkCommunication(State &state, const std::string &backend)
+{
+  int worldRank;
+  MPI_Comm_rank(MPI_COMM_WORLD, &worldRank);
+  RankGroup pair(worldRank < 2 ? 0 : MPI_UNDEFINED);
+  if (!pair.contains()) {
+    return;
+  }
+  const bool first = pair.rank() == 0;
+
+  // MPIDirectCommunication connects ranks of a participant, the others connect two participants
+  com::PtrCommunication com;
+  int                   remote = 0;
+  if (backend == "mpi-direct") {
+    com = std::make_shared<com::MPIDirectCommunication>();
+    com->connectIntraComm("Bench", "", pair.rank(), pair.size());
+    remote = first ? 1 : 0;
+  } else {
+    com = createCommunicationFactory(backend)->newCommunication();
+    if (first) {
+      com->acceptConnection("BenchA", "BenchB", "", 0);
+    } else {
+      com->requestConnection("BenchA", "BenchB", "", 0, 1);
+    }
+  }
+
+  auto acknowledge = [&] {
+    int ack = 0;
+    if (first) {
+      com->receive(ack, remote);
+    } else {
+      com->send(ack, remote);
+    }
+  };
+
+  constexpr int roundTrips = 100;
+  state.measure(
+      "pingPong", [&] {
+        double message = 1.0;
+        for (int i = 0; i < roundTrips; ++i) {
+          if (first) {
+            com->send(message, remote);
+            com->receive(message, remote);
+          } else {
+            com->receive(message, remote);
+            com->send(message, remote);
+          }
+        }
+      },
+      roundTrips);
+
+  constexpr int messages = 1000;
+  state.measure(
+      "messageRate", [&] {
+        double message = 1.0;
+        for (int i = 0; i < messages; ++i) {
+          if (first) {
+            com->send(message, remote);
+          } else {
+            com->receive(message, remote);
+          }
+        }
+        acknowledge();
+      },
+      messages);
+
+  // Streams 16 MiB per repetition in messages of different sizes
+  constexpr std::size_t totalBytes = 16 << 20;
+  for (std::size_t bytes : {std::size_t{64} << 10, std::size_t{1} << 20, totalBytes}) {
+    std::vector<double> buffer(bytes / sizeof(double), 1.0);
+    state.measure(
+        "bandwidth/" + (bytes < (1 << 20) ? std::to_string(bytes >> 10) + "KiB" : std::to_string(bytes >> 20) + "MiB"), [&] {
+          for (std::size_t sent = 0; sent < totalBytes; sent += bytes) {
+            if (first) {
+              com->send(precice::span<const double>{buffer}, remote);
+            } else {
+              com->receive(precice::span<double>{buffer}, remote);
+            }
+          }
+          acknowledge();
+        },
+        totalBytes);
+  }
+
+  // Sends a large message while computing, blocking and asynchronously
+  std::vector<double> message(totalBytes / sizeof(double), 1.0);
+  std::vector<double> work(message.size(), 1.0);
+  state.measure("overlap/compute", [&] {
+    if (first) {
+      compute(work);
+    }
+  });
+  state.measure("overlap/blocking", [&] {
+    if (first) {
+      com->send(precice::span<const double>{message}, remote);
+      compute(work);
+    } else {
+      com->receive(precice::span<double>{message}, remote);
+    }
+    acknowledge();
+  });
+  state.measure("overlap/async", [&] {
+    if (first) {
+      auto request = com->aSend(precice::span<const double>{message}, remote);
+      compute(work);
+      request->wait();
+    } else {
+      com->aReceive(precice::span<double>{message}, remote)->wait();
+    }
+    acknowledge();
+  });
+  com->closeConnection();
+}
+
+/**
+ * @brief Distributes the vertices of a mesh over the ranks of a participant.
+ *
+ * The acceptor owns contiguous blocks, while the requester owns interleaved blocks,
+ * such that every rank of one participant communicates with several ranks of the other.
+ */
+mesh::Mesh::VertexDistribution vertexDistribution(int vertices, int size, bool acceptor)
+{
+  mesh::Mesh::VertexDistribution distribution;
+  for (int rank = 0; rank < size; ++rank) {
+    distribution[rank];
+  }
+  const int block = std::max(1, vertices / (4 * size));
+  for (int vertex = 0; vertex < vertices; ++vertex) {
+    const int rank = acceptor ? static_cast<int>((static_cast<long>(vertex) * size) / vertices) : (vertex / block) % size;
+    distribution[rank].push_back(vertex);
+  }
+  return distribution;
+}
+
+/**
+ * @brief Measures the data exchange of an M2N between two participants.
+ *
+ * The first half of the ranks forms the acceptor, the second half the requester.
+ */
+void benchmarkM2N(State &state, const std::string &distribution, const std::string &backend)
+{
+  int worldRank, worldSize;
+  MPI_Comm_rank(MPI_COMM_WORLD, &worldRank);
+  MPI_Comm_size(MPI_COMM_WORLD, &worldSize);
+  const bool acceptor = worldRank < worldSize / 2;
+  RankGroup  participant(acceptor ? 0 : 1);
+  const auto name = acceptor ? "BenchA" : "BenchB";
+
+  utils::IntraComm::configure(participant.rank(), participant.size());
+  if (participant.size() > 1) {
+    utils::IntraComm::getCommunication() = std::make_shared<com::MPIDirectCommunication>();
+    utils::IntraComm::getCommunication()->connectIntraComm(name, "", participant.rank(), participant.size());
+  }
+
+  auto                                      factory = createCommunicationFactory(backend);
+  auto                                      com     = factory->newCommunication();
+  m2n::DistributedComFactory::SharedPointer distributedFactory;
+  if (distribution == "gather-scatter") {
+    distributedFactory = std::make_shared<m2n::GatherScatterComFactory>(com);
+  } else {
+    distributedFactory = std::make_shared<m2n::PointToPointComFactory>(factory);
+  }
+  m2n::M2N m2n(com, distributedFactory);
+
+  const int     vertices = state.options().vertices;
+  mesh::PtrMesh mesh(new mesh::Mesh("Mesh", 3, 0));
+  mesh->setGlobalNumberOfVertices(vertices);
+  mesh->setVertexDistribution(vertexDistribution(vertices, participant.size(), acceptor));
+
+  if (acceptor) {
+    m2n.acceptPrimaryRankConnection("BenchA", "BenchB");
+    m2n.createDistributedCommunication(mesh);
+    m2n.acceptSecondaryRanksConnection("BenchA", "BenchB");
+  } else {
+    m2n.requestPrimaryRankConnection("BenchA", "BenchB");
+    m2n.createDistributedCommunication(mesh);
+    m2n.requestSecondaryRanksConnection("BenchA", "BenchB");
+  }
+
+  state.setParameter("ranks-acceptor", static_cast<long>(worldSize / 2));
+  state.setParameter("ranks-requester", static_cast<long>(worldSize - worldSize / 2));
+  state.setParameter("vertices", static_cast<long>(vertices));
+
+  // The acceptor sends the data to the requester, which sends it back
+  std::vector<double> values(mesh->getVertexDistribution().at(participant.rank()).size(), 1.0);
+  state.measure(
+      "exchange", [&] {
+        if (acceptor) {
+          m2n.send(values, mesh->getID(), 1);
+          m2n.receive(values, mesh->getID(), 1);
+        } else {
+          m2n.receive(values, mesh->getID(), 1);
+          m2n.send(values, mesh->getID(), 1);
+        }
+      },
+      2.0 * vertices);
+
+  m2n.closeConnection();
+  if (participant.size() > 1) {
+    utils::IntraComm::getCommunication()->closeConnection();
+  }
+  utils::IntraComm::getCommunication() = nullptr;
+  utils::IntraComm::configure(0, 1);
+}
+
+} // namespace
+
+void registerCommunicationBenchmarks()
+{
+  auto backends = interParticipantBackends();
+  for (const auto &backend : backends) {
+    registerBenchmark(
+        "com/" + backend, [backend](State &state) { benchmarkCommunication(state, backend); }, true);
+    for (const std::string distribution : {"gather-scatter", "point-to-point"}) {
+      registerBenchmark(
+          "m2n/" + distribution + "/" + backend, [distribution, backend](State &state) { benchmarkM2N(state, distribution, backend); }, true);
+    }
+  }
+  registerBenchmark(
+      "com/mpi-direct", [](State &state) { benchmarkCommunication(state, "mpi-direct"); }, true);
+}
+
+} // namespace precice::benchmarks
+
+#else
+
+#include "Benchmark.hpp"
+
+namespace precice::benchmarks {
+
+// The communication benchmarks require at least two MPI ranks
+void registerCommunicationBenchmarks()
+{
+}
+
+} // namespace precice::benchmarks
+
+#endif // PRECICE_NO_MPI
@@ -0,0 +1,376 @@
+#ifndef PRECICE_NO_MPI
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <mpi.h>
+#include <precice/precice.hpp>
+#include <regex>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "Benchmark.hpp"
+#include "SyntheticMeshes.hpp"
+#include "utils/fmt.hpp"
+
+namespace precice::benchmarks {
+
+namespace {
+
+/// A coupled simulation to benchmark, as it is written in the configuration
+struct CouplingCase {
+  /// The coupling scheme tag, such as serial-implicit
+  std::string scheme;
+  /// The acceleration tag, empty for explicit schemes and "none" for implicit schemes without acceleration
+  std::string acceleration;
+  /// The mapping tag used for the consistent read and the conservative write mapping of SolverTwo
+  std::string mapping;
+
+  bool implicit() const
+  {
+    return scheme.find("implicit") != std::string::npos;
+  }
+
+  std::string name() const
+  {
+    std::string name = "coupling/" + scheme;
+    if (!acceleration.empty()) {
+      name += "/" + acceleration;
+    }
+    return name + "/" + mapping;
+  }
+};
+
+std::vector<std::string> dataNames(const std::string &prefix, int fields)
+{
+  std::vector<std::string> names;
+  for (int i = 0; i < fields; ++i) {
+    names.push_back(prefix + std::to_string(i));
+  }
+  return names;
+}
+
+/**
+ * @brief Generates the configuration of the coupled run
+ *
+ * SolverOne provides MeshOne and writes the data A*, SolverTwo provides MeshTwo and writes the data B*.
+ * SolverTwo receives MeshOne and maps in both directions, so all data is exchanged on MeshOne.
+ */
+std::string configuration(const CouplingCase &couplingCase, const Options &options)
+{
+  const auto dataA = dataNames("A", options.fields);
+  const auto dataB = dataNames("B", options.fields);
+
+  // Substeps are only used by implicit schemes and not yet supported by the quasi-Newton accelerations
+  const bool substeps = options.substeps > 1 && couplingCase.acceleration == "none";
+
+  std::string data, useData, solverOne, solverTwo, exchanges, measures, accelerationData;
+  for (const auto &name : dataA) {
+    data += fmt::format("  <data:scalar name=\"{}\" />\n", name);
+    useData += fmt::format("    <use-data name=\"{}\" />\n", name);
+    solverOne += fmt::format("    <write-data name=\"{}\" mesh=\"MeshOne\" />\n", name);
+    solverTwo += fmt::format("    <read-data name=\"{}\" mesh=\"MeshTwo\" />\n", name);
+    exchanges += fmt::format("    <exchange data=\"{}\" mesh=\"MeshOne\" from=\"SolverOne\" to=\"SolverTwo\" substeps=\"{}\" />\n", name, substeps);
+  }
+  for (const auto &name : dataB) {
+    data += fmt::format("  <data:scalar name=\"{}\" />\n", name);
+    useData += fmt::format("    <use-data name=\"{}\" />\n", name);
+    solverOne += fmt::format("    <read-data name=\"{}\" mesh=\"MeshOne\" />\n", name);
+    solverTwo += fmt::format("    <write-data name=\"{}\" mesh=\"MeshTwo\" />\n", name);
+    exchanges += fmt::format("    <exchange data=\"{}\" mesh=\"MeshOne\" from=\"SolverTwo\" to=\"SolverOne\" substeps=\"{}\" />\n", name, substeps);
+  }
+
+  std::string implicit;
+  if (couplingCase.implicit()) {
+    // Serial schemes only accelerate the data of the second participant
+    const bool parallel = couplingCase.scheme == "parallel-implicit";
+    for (const auto &names : {dataA, dataB}) {
+      for (const auto &name : names) {
+        measures += fmt::format("    <relative-convergence-measure limit=\"1e-5\" data=\"{}\" mesh=\"MeshOne\" />\n", name);
+        if (parallel || name.front() == 'B') {
+          accelerationData += fmt::format("      <data name=\"{}\" mesh=\"MeshOne\" />\n", name);
+        }
+      }
+    }
+    implicit = "    <max-iterations value=\"50\" />\n" + measures;
+    if (couplingCase.acceleration != "none") {
+      implicit += fmt::format(R"(    <acceleration:{0}>
+{1}      <filter type="QR2" limit="1e-3" />
+      <initial-relaxation value="0.5" />
+      <max-used-iterations value="20" />
+      <time-windows-reused value="2" />
+    </acceleration:{0}>
+)",
+                              couplingCase.acceleration, accelerationData);
+    }
+  }
+
+  const std::string basisFunction = couplingCase.mapping.rfind("rbf", 0) == 0 ? "      <basis-function:thin-plate-splines />\n" : "";
+
+  return fmt::format(R"(<?xml version="1.0" encoding="UTF-8" ?>
+<precice-configuration>
+  <profiling mode="all" flush-every="0" directory="{dir}" />
+
+{data}
+  <mesh name="MeshOne" dimensions="3">
+{useData}  </mesh>
+
+  <mesh name="MeshTwo" dimensions="3">
+{useData}  </mesh>
+
+  <participant name="SolverOne">
+    <provide-mesh name="MeshOne" />
+{solverOne}  </participant>
+
+  <participant name="SolverTwo">
+    <receive-mesh name="MeshOne" from="SolverOne" />
+    <provide-mesh name="MeshTwo" />
+    <mapping:{mapping} direction="read" from="MeshOne" to="MeshTwo" constraint="consistent">
+{basisFunction}    </mapping:{mapping}>
+    <mapping:{mapping} direction="write" from="MeshTwo" to="MeshOne" constraint="conservative">
+{basisFunction}    </mapping:{mapping}>
+{solverTwo}  </participant>
+
+  <m2n:{m2n} acceptor="SolverOne" connector="SolverTwo" exchange-directory="{dir}" />
+
+  <coupling-scheme:{scheme}>
+    <participants first="SolverOne" second="SolverTwo" />
+    <max-time-windows value="{windows}" />
+    <time-window-size value="1.0" />
+{exchanges}{implicit}  </coupling-scheme:{scheme}>
+</precice-configuration>
+)",
+                     fmt::arg("dir", runDirectory),
+                     fmt::arg("data", data),
+                     fmt::arg("useData", useData),
+                     fmt::arg("solverOne", solverOne),
+                     fmt::arg("solverTwo", solverTwo),
+                     fmt::arg("mapping", couplingCase.mapping),
+                     fmt::arg("basisFunction", basisFunction),
+                     fmt::arg("m2n", options.m2n),
+                     fmt::arg("scheme", couplingCase.scheme),
+                     fmt::arg("windows", options.timeWindows),
+                     fmt::arg("exchanges", exchanges),
+                     fmt::arg("implicit", implicit));
+}
+
+/// Timings of a single coupled run of one rank
+struct Run {
+  double initialize   = 0;
+  double couplingLoop = 0;
+  int    advanceCalls = 0;
+};
+
+/**
+ * @brief Runs a synthetic solver through a complete coupled simulation.
+ *
+ * The solvers form a contraction, such that implicit schemes converge after a few iterations:
+ * SolverOne writes A = 0.5 cos(B) + 0.1 x sin(t), SolverTwo writes B = 0.5 sin(A) + 0.1 y cos(t).
+ */
+Run runSolver(const std::string &config, const Options &options, bool isSolverOne, MPI_Comm comm)
+{
+  using Clock = std::chrono::steady_clock;
+
+  int rank, size;
+  MPI_Comm_rank(comm, &rank);
+  MPI_Comm_size(comm, &size);
+
+  const std::string meshName       = isSolverOne ? "MeshOne" : "MeshTwo";
+  const int         verticesOnEdge = surfaceVerticesPerEdge(options.vertices) + (isSolverOne ? 0 : 1);
+  const auto        writeNames     = dataNames(isSolverOne ? "A" : "B", options.fields);
+  const auto        readNames      = dataNames(isSolverOne ? "B" : "A", options.fields);
+
+  precice::Participant participant(isSolverOne ? "SolverOne" : "SolverTwo", config, rank, size, &comm);
+
+  const auto             coordinates = surfaceCoordinates(verticesOnEdge, rank, size);
+  std::vector<VertexID>  ids(coordinates.size() / 3);
+  std::vector<double>    readValues(ids.size()), writeValues(ids.size());
+  participant.setMeshVertices(meshName, coordinates, ids);
+
+  Run  run;
+  auto start = Clock::now();
+  participant.initialize();
+  run.initialize = std::chrono::duration<double>(Clock::now() - start).count();
+
+  const double stepSize = 1.0 / options.substeps;
+  double       time = 0, checkpoint = 0;
+  start                 = Clock::now();
+  while (participant.isCouplingOngoing()) {
+    if (participant.requiresWritingCheckpoint()) {
+      checkpoint = time;
+    }
+    const double dt = std::min(participant.getMaxTimeStepSize(), stepSize);
+    time += dt;
+    for (int field = 0; field < options.fields; ++field) {
+      participant.readData(meshName, readNames[field], ids, dt, readValues);
+      for (std::size_t i = 0; i < ids.size(); ++i) {
+        writeValues[i] = isSolverOne ? 0.5 * std::cos(readValues[i]) + 0.1 * coordinates[3 * i] * std::sin(time)
+                                     : 0.5 * std::sin(readValues[i]) + 0.1 * coordinates[3 * i + 1] * std::cos(time);
+      }
+      participant.writeData(meshName, writeNames[field], ids, writeValues);
+    }
+    participant.advance(dt);
+    if (participant.requiresReadingCheckpoint()) {
+      time = checkpoint;
+    }
+    ++run.advanceCalls;
+  }
+  run.couplingLoop = std::chrono::duration<double>(Clock::now() - start).count();
+
+  participant.finalize();
+  return run;
+}
+
+/**
+ * @brief Extracts the durations of the advance event and its direct subevents from a profiling file.
+ *
+ * These are the communication, mapping, and acceleration steps of the advance call.
+ *
+ * @returns the durations in seconds of all instances of the events by name
+ */
+std::map<std::string, std::vector<double>> advanceBreakdown(const std::filesystem::path &file)
+{
+  std::ifstream     in(file);
+  std::stringstream content;
+  content << in.rdbuf();
+  const std::string events = content.str();
+
+  // Name entries look like {"et":"n","en":"advance","eid":3}, others like {"et":"b","eid":3,"ts":1234}
+  const std::regex entry(R"re(\{"et":"([nbe])"(?:,"en":"([^"]*)")?,"eid":(\d+)(?:,"ts":(\d+))?)re");
+
+  std::map<int, std::string>                 names;
+  std::map<int, long long>                   starts;
+  std::map<std::string, std::vector<double>> durations;
+  for (auto it = std::sregex_iterator(events.begin(), events.end(), entry); it != std::sregex_iterator(); ++it) {
+    const auto &match = *it;
+    const int   id    = std::stoi(match[3]);
+    if (match[1] == "n") {
+      names[id] = match[2];
+      continue;
+    }
+    const auto &name = names[id];
+    const bool subevent = name.rfind("advance/", 0) == 0 && name.find('/', 8) == std::string::npos;
+    const bool synced   = name.size() > 5 && name.compare(name.size() - 5, 5, ".sync") == 0;
+    if ((name != "advance" && !subevent) || synced) {
+      continue;
+    }
+    const long long timestamp = std::stoll(match[4]);
+    if (match[1] == "b") {
+      starts[id] = timestamp;
+    } else {
+      durations[name].push_back(1e-6 * (timestamp - starts[id]));
+    }
+  }
+  return durations;
+}
+
+void benchmarkCoupling(State &state, const CouplingCase &couplingCase)
+{
+  const auto &options = state.options();
+
+  int worldRank, worldSize;
+  MPI_Comm_rank(MPI_COMM_WORLD, &worldRank);
+  MPI_Comm_size(MPI_COMM_WORLD, &worldSize);
+
+  // The first half of the ranks runs SolverOne, the second half SolverTwo
+  const bool isSolverOne = worldRank < worldSize / 2;
+  MPI_Comm   comm;
+  MPI_Comm_split(MPI_COMM_WORLD, isSolverOne ? 0 : 1, worldRank, &comm);
+
+  const auto config = std::filesystem::path(runDirectory) / "precice-config.xml";
+  if (worldRank == 0) {
+    std::filesystem::create_directories(runDirectory);
+    std::ofstream(config) << configuration(couplingCase, options);
+  }
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  const int  verticesOnEdge = surfaceVerticesPerEdge(options.vertices);
+  const long verticesOne    = static_cast<long>(verticesOnEdge) * verticesOnEdge;
+  const long verticesTwo    = static_cast<long>(verticesOnEdge + 1) * (verticesOnEdge + 1);
+  state.setParameter("ranks-one", static_cast<long>(worldSize / 2));
+  state.setParameter("ranks-two", static_cast<long>(worldSize - worldSize / 2));
+  state.setParameter("vertices-one", verticesOne);
+  state.setParameter("vertices-two", verticesTwo);
+
+  std::vector<double>                        initialize, couplingLoop;
+  std::map<std::string, std::vector<double>> breakdown;
+  int                                        advanceCalls = 0;
+  for (int repetition = 0; repetition < options.warmup + options.repetitions; ++repetition) {
+    const auto run = runSolver(config.string(), options, isSolverOne, comm);
+    if (repetition < options.warmup) {
+      continue;
+    }
+    initialize.push_back(run.initialize);
+    couplingLoop.push_back(run.couplingLoop);
+    advanceCalls = run.advanceCalls;
+
+    // Wait for both participants to write their profiling files
+    MPI_Barrier(MPI_COMM_WORLD);
+    if (worldRank != 0) {
+      continue;
+    }
+    const auto directory = std::filesystem::path(runDirectory) / "precice-profiling";
+    for (const auto &[participant, size] : {std::pair{"SolverOne", worldSize / 2}, std::pair{"SolverTwo", worldSize - worldSize / 2}}) {
+      for (auto &[name, durations] : advanceBreakdown(directory / fmt::format("{}-0-{}.json", participant, size))) {
+        auto &all = breakdown[fmt::format("{}/{}", participant, name)];
+        all.insert(all.end(), durations.begin(), durations.end());
+      }
+    }
+  }
+  MPI_Comm_free(&comm);
+
+  state.setParameter("advance-calls", static_cast<long>(advanceCalls));
+  state.record("initialize", initialize);
+  // The throughput counts the values written by both participants
+  state.record("couplingLoop", couplingLoop, static_cast<double>(options.fields) * (verticesOne + verticesTwo) * advanceCalls);
+  for (const auto &[name, durations] : breakdown) {
+    state.record(name, durations);
+  }
+}
+
+std::vector<CouplingCase> couplingCases()
+{
+  std::vector<CouplingCase> cases;
+  for (const std::string mapping : {"nearest-neighbor", "rbf-pum-direct"}) {
+    for (const std::string scheme : {"serial-explicit", "parallel-explicit"}) {
+      cases.push_back({scheme, "", mapping});
+    }
+    for (const std::string scheme : {"serial-implicit", "parallel-implicit"}) {
+      for (const std::string acceleration : {"none", "IQN-ILS", "IQN-IMVJ"}) {
+        cases.push_back({scheme, acceleration, mapping});
+      }
+    }
+  }
+  return cases;
+}
+
+} // namespace
+
+void registerCouplingBenchmarks()
+{
+  for (const auto &couplingCase : couplingCases()) {
+    registerBenchmark(
+        couplingCase.name(), [couplingCase](State &state) { benchmarkCoupling(state, couplingCase); }, true);
+  }
+}
+
+} // namespace precice::benchmarks
+
+#else
+
+#include "Benchmark.hpp"
+
+namespace precice::benchmarks {
+
+// The coupling benchmarks run the participants on separate MPI ranks
+void registerCouplingBenchmarks()
+{
+}
+
+} // namespace precice::benchmarks
+
+#endif // PRECICE_NO_MPI
@@ -0,0 +1,235 @@
+#include <fstream>
+#include <iostream>
+#include <precice/Exceptions.hpp>
+#include <regex>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "Benchmark.hpp"
+#include "logging/LogConfiguration.hpp"
+#include "utils/Parallel.hpp"
+#include "utils/Petsc.hpp"
+
+#ifndef PRECICE_NO_MPI
+#include <mpi.h>
+#endif
+
+namespace {
+
+void printUsage()
+{
+  std::cerr << "Usage: [mpirun -np N] precice-bench [OPTIONS]\n\n";
+  std::cerr << "Runs the preCICE benchmarks and prints the results as JSON.\n";
+  std::cerr << "The communication and coupling benchmarks run on all MPI ranks and require at least 2 ranks.\n\n";
+  std::cerr << "  --list             Print the names of all benchmarks and exit\n";
+  std::cerr << "  --filter REGEX     Only run benchmarks whose name matches REGEX\n";
+  std::cerr << "  --vertices N       Approximate number of vertices of the input meshes (default 1000)\n";
+  std::cerr << "  --repetitions N    Number of timed repetitions of every phase (default 5)\n";
+  std::cerr << "  --warmup N         Number of untimed repetitions before the timed ones (default 1)\n";
+  std::cerr << "  --fields N         Number of data fields written by every participant (default 2)\n";
+  std::cerr << "  --substeps N       Number of substeps per time window (default 1)\n";
+  std::cerr << "  --time-windows N   Number of time windows per coupled run (default 10)\n";
+  std::cerr << "  --m2n TYPE         The m2n used by the coupling benchmarks (default sockets)\n";
+  std::cerr << "  --output FILE      Write the results to FILE instead of stdout\n\n";
+  std::cerr << "Compare two result files with tools/benchmarking/compare-benchmarks.\n";
+}
+
+/// Only logs warnings and errors to stderr unless a log.conf is present, keeping stdout for the results
+void setupLogging()
+{
+  using namespace precice::logging;
+  auto configs = readLogConfFile("log.conf");
+  if (configs.empty()) {
+    BackendConfiguration config;
+    config.filter = "%Severity% >= warning";
+    config.output = "stderr";
+    configs.push_back(config);
+  }
+  setupLogging(configs);
+  // Prevent participants from overriding the logging
+  lockConf();
+}
+
+int worldRank()
+{
+  int rank = 0;
+#ifndef PRECICE_NO_MPI
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+#endif
+  return rank;
+}
+
+int worldSize()
+{
+  int size = 1;
+#ifndef PRECICE_NO_MPI
+  MPI_Comm_size(MPI_COMM_WORLD, &size);
+#endif
+  return size;
+}
+
+/// Runs a serial benchmark on the current rank only, like a serial participant
+void runSerial(const precice::benchmarks::Benchmark &benchmark, precice::benchmarks::State &state)
+{
+  using precice::utils::Parallel;
+#ifndef PRECICE_NO_MPI
+  Parallel::initializeOrDetectMPI(MPI_COMM_SELF);
+#else
+  Parallel::initializeOrDetectMPI();
+#endif
+  try {
+    benchmark.function(state);
+  } catch (...) {
+    Parallel::finalizeOrCleanupMPI();
+    throw;
+  }
+  Parallel::finalizeOrCleanupMPI();
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+  using namespace precice::benchmarks;
+
+  Options     options;
+  std::string filter;
+  std::string outputFile;
+  bool        list = false;
+
+  const std::vector<std::string> args(argv + 1, argv + argc);
+  try {
+    for (std::size_t i = 0; i < args.size(); ++i) {
+      const auto &arg       = args[i];
+      auto        nextValue = [&]() -> const std::string & {
+        if (i + 1 >= args.size()) {
+          throw std::invalid_argument("missing value of " + arg);
+        }
+        return args[++i];
+      };
+      if (arg == "--list") {
+        list = true;
+      } else if (arg == "--filter") {
+        filter = nextValue();
+      } else if (arg == "--vertices") {
+        options.vertices = std::stoi(nextValue());
+      } else if (arg == "--repetitions") {
+        options.repetitions = std::stoi(nextValue());
+      } else if (arg == "--warmup") {
+        options.warmup = std::stoi(nextValue());
+      } else if (arg == "--fields") {
+        options.fields = std::stoi(nextValue());
+      } else if (arg == "--substeps") {
+        options.substeps = std::stoi(nextValue());
+      } else if (arg == "--time-windows") {
+        options.timeWindows = std::stoi(nextValue());
+      } else if (arg == "--m2n") {
+        options.m2n = nextValue();
+      } else if (arg == "--output") {
+        outputFile = nextValue();
+      } else if (arg == "--help" || arg == "-h") {
+        printUsage();
+        return 0;
+      } else {
+        throw std::invalid_argument("unknown argument " + arg);
+      }
+    }
+    if (options.vertices < 1 || options.repetitions < 1 || options.warmup < 0) {
+      throw std::invalid_argument("vertices and repetitions need to be positive, warmup cannot be negative");
+    }
+    if (options.fields < 1 || options.substeps < 1 || options.timeWindows < 1) {
+      throw std::invalid_argument("fields, substeps, and time windows need to be positive");
+    }
+  } catch (const std::logic_error &e) {
+    std::cerr << "ERROR: " << e.what() << "\n\n";
+    printUsage();
+    return 1;
+  }
+
+  registerCommunicationBenchmarks();
+  registerCouplingBenchmarks();
+  registerMeshBenchmarks();
+  registerMappingBenchmarks();
+  registerQueryBenchmarks();
+
+  std::regex pattern;
+  try {
+    pattern = std::regex(filter);
+  } catch (const std::regex_error &e) {
+    std::cerr << "ERROR: invalid filter \"" << filter << "\": " << e.what() << '\n';
+    return 1;
+  }
+
+  std::vector<const Benchmark *> selected;
+  for (const auto &benchmark : registeredBenchmarks()) {
+    if (std::regex_search(benchmark.name, pattern)) {
+      selected.push_back(&benchmark);
+    }
+  }
+
+  if (list) {
+    for (const auto *benchmark : selected) {
+      std::cout << benchmark->name << '\n';
+    }
+    return 0;
+  }
+
+  // The benchmarks handle MPI like solvers, which pass their communicator to preCICE
+#ifndef PRECICE_NO_MPI
+  MPI_Init(&argc, &argv);
+#endif
+  setupLogging();
+  const int rank = worldRank();
+  const int size = worldSize();
+
+  std::vector<Measurement> measurements;
+  int                      failures = 0;
+  for (const auto *benchmark : selected) {
+    // Serial benchmarks run on the primary rank only, parallel benchmarks on all ranks
+    if (!benchmark->parallel && rank != 0) {
+      continue;
+    }
+    if (benchmark->parallel && size < 2) {
+      std::cerr << "Skipping " << benchmark->name << " as it requires at least 2 MPI ranks\n";
+      continue;
+    }
+    if (rank == 0) {
+      std::cerr << "Running " << benchmark->name << '\n';
+    }
+    State state(benchmark->name, options);
+    try {
+      if (benchmark->parallel) {
+        benchmark->function(state);
+      } else {
+        runSerial(*benchmark, state);
+      }
+    } catch (const ::precice::Error &) {
+      std::cerr << "FAILED " << benchmark->name << '\n';
+#ifndef PRECICE_NO_MPI
+      // The other participant would wait forever for the failed one
+      if (benchmark->parallel) {
+        MPI_Abort(MPI_COMM_WORLD, 2);
+      }
+#endif
+      ++failures;
+      continue;
+    }
+    measurements.insert(measurements.end(), state.measurements().begin(), state.measurements().end());
+  }
+
+  if (rank == 0) {
+    if (outputFile.empty()) {
+      writeJSON(std::cout, options, size, measurements);
+    } else {
+      std::ofstream out(outputFile);
+      writeJSON(out, options, size, measurements);
+    }
+  }
+
+  precice::utils::Petsc::finalize();
+#ifndef PRECICE_NO_MPI
+  MPI_Finalize();
+#endif
+  return failures == 0 ? 0 : 2;
+}
@@ -0,0 +1,183 @@
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "Benchmark.hpp"
+#include "SyntheticMeshes.hpp"
+#include "mapping/Mapping.hpp"
+#include "mapping/config/MappingConfiguration.hpp"
+#include "mesh/Mesh.hpp"
+#include "mesh/config/DataConfiguration.hpp"
+#include "mesh/config/MeshConfiguration.hpp"
+#include "time/Sample.hpp"
+#include "utils/Parallel.hpp"
+#include "utils/fmt.hpp"
+#include "xml/XMLTag.hpp"
+
+namespace precice::benchmarks {
+
+namespace {
+
+/// A mapping to benchmark, as it is written in the configuration
+struct MappingCase {
+  /// The mapping tag, such as rbf-global-direct
+  std::string type;
+  /// The executor subtag, empty for the default executor
+  std::string executor;
+  /// The basis function subtag, empty for mappings without basis function
+  std::string basisFunction;
+  /// Map between volume meshes instead of surface meshes
+  bool volume;
+
+  std::string name() const
+  {
+    std::string name = "mapping/" + type;
+    for (const auto &part : {executor, basisFunction}) {
+      if (!part.empty()) {
+        name += "/" + part;
+      }
+    }
+    return name + (volume ? "/volume" : "/surface");
+  }
+};
+
+/// Parameters of the basis function, scaled by the grid spacing of the input mesh
+std::string basisFunctionAttributes(const std::string &basisFunction, double spacing)
+{
+  if (basisFunction == "thin-plate-splines" || basisFunction == "volume-splines") {
+    return "";
+  }
+  if (basisFunction == "multiquadrics" || basisFunction == "inverse-multiquadrics") {
+    return fmt::format(R"(shape-parameter="{}")", spacing);
+  }
+  if (basisFunction == "gaussian") {
+    return fmt::format(R"(shape-parameter="{}")", 1.0 / spacing);
+  }
+  // compactly supported functions
+  return fmt::format(R"(support-radius="{}")", 5.0 * spacing);
+}
+
+/**
+ * @brief Creates the mapping via the mapping configuration, like preCICE does.
+ *
+ * This ensures that the benchmarks cover the same mapping classes and default parameters as a coupled simulation.
+ */
+mapping::PtrMapping configureMapping(const MappingCase &mappingCase, double spacing, const mesh::PtrMesh &input, const mesh::PtrMesh &output)
+{
+  std::string subtags;
+  if (!mappingCase.executor.empty()) {
+    subtags += fmt::format("    <executor:{} />\n", mappingCase.executor);
+  }
+  if (!mappingCase.basisFunction.empty()) {
+    subtags += fmt::format("    <basis-function:{} {} />\n", mappingCase.basisFunction, basisFunctionAttributes(mappingCase.basisFunction, spacing));
+  }
+  const auto xml = fmt::format(R"(<?xml version="1.0" encoding="UTF-8" ?>
+<configuration>
+  <mesh name="Input" dimensions="3" />
+  <mesh name="Output" dimensions="3" />
+  <mapping:{} direction="read" from="Input" to="Output" constraint="consistent">
+{}  </mapping:{}>
+</configuration>
+)",
+                               mappingCase.type, subtags, mappingCase.type);
+
+  const auto file = std::filesystem::temp_directory_path() / fmt::format("precice-bench-mapping-{}.xml", utils::Parallel::getProcessRank());
+  std::ofstream(file) << xml;
+
+  xml::XMLTag                   tag = xml::getRootTag();
+  mesh::PtrDataConfiguration    dataConfig(new mesh::DataConfiguration(tag));
+  mesh::PtrMeshConfiguration    meshConfig(new mesh::MeshConfiguration(tag, dataConfig));
+  mapping::MappingConfiguration mappingConfig(tag, meshConfig);
+  xml::configure(tag, xml::ConfigurationContext{}, file.string());
+  std::filesystem::remove(file);
+
+  auto mapping = mappingConfig.mappings().front().mapping;
+  mapping->setMeshes(input, output);
+  return mapping;
+}
+
+void benchmarkMapping(State &state, const MappingCase &mappingCase)
+{
+  mesh::PtrMesh input(new mesh::Mesh("Input", 3, 0));
+  mesh::PtrMesh output(new mesh::Mesh("Output", 3, 1));
+
+  // The output meshes use a different resolution, such that no vertices coincide
+  double spacing = 0.0;
+  if (mappingCase.volume) {
+    const int n = volumeVerticesPerEdge(state.options().vertices);
+    fillVolumeMesh(*input, n, 0.0, 1.0, Connectivity::Implicit);
+    fillVolumeMesh(*output, n + 1, 0.01, 0.99, Connectivity::None);
+    spacing = 1.0 / (n - 1);
+  } else {
+    const int n = surfaceVerticesPerEdge(state.options().vertices);
+    fillSurfaceMesh(*input, n, Connectivity::Implicit);
+    fillSurfaceMesh(*output, n + 1, Connectivity::None);
+    spacing = 1.0 / (n - 1);
+  }
+  // Set up the meshes as the partitioning of a serial participant does
+  for (const auto &mesh : {input, output}) {
+    mesh->preprocess();
+    mesh->computeBoundingBox();
+    mesh->setGlobalNumberOfVertices(mesh->nVertices());
+  }
+
+  state.setParameter("input-vertices", static_cast<long>(input->nVertices()));
+  state.setParameter("output-vertices", static_cast<long>(output->nVertices()));
+
+  auto mapping = configureMapping(mappingCase, spacing, input, output);
+
+  state.measure(
+      "computeMapping", [&] { mapping->clear(); }, [&] { mapping->computeMapping(); });
+
+  time::Sample sample(1, evaluateTestFunction(*input));
+  if (mapping->requiresGradientData()) {
+    sample.gradients = evaluateTestGradient(*input);
+  }
+  Eigen::VectorXd result = Eigen::VectorXd::Zero(output->nVertices());
+  if (mapping->requiresInitialGuess()) {
+    Eigen::VectorXd initialGuess;
+    state.measure(
+        "map", [&] { initialGuess.resize(0); }, [&] { mapping->map(sample, result, initialGuess); });
+  } else {
+    state.measure("map", [&] { mapping->map(sample, result); });
+  }
+}
+
+std::vector<MappingCase> mappingCases()
+{
+  const std::vector<std::string> basisFunctions{
+      "compact-polynomial-c0", "compact-polynomial-c2", "compact-polynomial-c4", "compact-polynomial-c6", "compact-polynomial-c8",
+      "compact-tps-c2", "gaussian", "inverse-multiquadrics", "multiquadrics", "thin-plate-splines", "volume-splines"};
+
+  std::vector<MappingCase> cases;
+  for (bool volume : {false, true}) {
+    cases.push_back({"nearest-neighbor", "", "", volume});
+    cases.push_back({"nearest-neighbor-gradient", "", "", volume});
+    if (volume) {
+      cases.push_back({"linear-cell-interpolation", "", "", volume});
+    } else {
+      cases.push_back({"nearest-projection", "", "", volume});
+    }
+    for (const auto &basisFunction : basisFunctions) {
+      cases.push_back({"rbf-global-direct", "", basisFunction, volume});
+#ifndef PRECICE_NO_PETSC
+      cases.push_back({"rbf-global-iterative", "cpu", basisFunction, volume});
+#endif
+      cases.push_back({"rbf-global-iterative", "hmatrix", basisFunction, volume});
+      cases.push_back({"rbf-pum-direct", "", basisFunction, volume});
+    }
+  }
+  return cases;
+}
+
+} // namespace
+
+void registerMappingBenchmarks()
+{
+  for (const auto &mappingCase : mappingCases()) {
+    registerBenchmark(mappingCase.name(), [mappingCase](State &state) { benchmarkMapping(state, mappingCase); });
+  }
+}
+
+} // namespace precice::benchmarks
@@ -0,0 +1,157 @@
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <precice/precice.hpp>
+#include <string>
+#include <vector>
+
+#include "Benchmark.hpp"
+#include "SyntheticMeshes.hpp"
+#include "mesh/Mesh.hpp"
+#include "utils/fmt.hpp"
+
+#ifndef PRECICE_NO_MPI
+#include <mpi.h>
+#endif
+
+namespace precice::benchmarks {
+
+namespace {
+
+void benchmarkPreprocess(State &state, bool volume)
+{
+  mesh::Mesh mesh("Mesh", 3, 0);
+
+  const int verticesPerEdge = volume ? volumeVerticesPerEdge(state.options().vertices) : surfaceVerticesPerEdge(state.options().vertices);
+  auto      fill            = [&] {
+    mesh.clear();
+    if (volume) {
+      fillVolumeMesh(mesh, verticesPerEdge, 0.0, 1.0, Connectivity::Implicit);
+    } else {
+      fillSurfaceMesh(mesh, verticesPerEdge, Connectivity::Explicit);
+    }
+  };
+
+  fill();
+  state.setParameter("vertices", static_cast<long>(mesh.nVertices()));
+  state.setParameter("edges", static_cast<long>(mesh.edges().size()));
+  state.setParameter("triangles", static_cast<long>(mesh.triangles().size()));
+  state.setParameter("tetrahedra", static_cast<long>(mesh.tetrahedra().size()));
+
+  state.measure("preprocess", fill, [&] { mesh.preprocess(); });
+}
+
+/**
+ * @brief Writes a configuration in which SolverOne provides a mesh requiring connectivity.
+ *
+ * The linear-cell-interpolation from MeshOne requires its vertices, triangles, and tetrahedra.
+ * SolverOne is only constructed, such that SolverTwo never has to run.
+ */
+std::string writeRegistrationConfig()
+{
+  std::filesystem::create_directories(runDirectory);
+  const auto filename = (std::filesystem::path(runDirectory) / "registration-config.xml").string();
+  std::ofstream(filename) << fmt::format(R"(<?xml version="1.0" encoding="UTF-8" ?>
+<precice-configuration>
+  <profiling mode="off" />
+  <data:scalar name="Data" />
+
+  <mesh name="MeshOne" dimensions="3">
+    <use-data name="Data" />
+  </mesh>
+
+  <mesh name="MeshTwo" dimensions="3">
+    <use-data name="Data" />
+  </mesh>
+
+  <participant name="SolverOne">
+    <provide-mesh name="MeshOne" />
+    <receive-mesh name="MeshTwo" from="SolverTwo" />
+    <write-data name="Data" mesh="MeshOne" />
+    <mapping:linear-cell-interpolation direction="write" from="MeshOne" to="MeshTwo" constraint="consistent" />
+  </participant>
+
+  <participant name="SolverTwo">
+    <provide-mesh name="MeshTwo" />
+    <read-data name="Data" mesh="MeshTwo" />
+  </participant>
+
+  <m2n:sockets acceptor="SolverOne" connector="SolverTwo" exchange-directory="{dir}" />
+
+  <coupling-scheme:serial-explicit>
+    <participants first="SolverOne" second="SolverTwo" />
+    <max-time-windows value="1" />
+    <time-window-size value="1.0" />
+    <exchange data="Data" mesh="MeshTwo" from="SolverOne" to="SolverTwo" />
+  </coupling-scheme:serial-explicit>
+</precice-configuration>
+)",
+                                         fmt::arg("dir", runDirectory));
+  return filename;
+}
+
+std::unique_ptr<precice::Participant> constructSolverOne(const std::string &config)
+{
+#ifndef PRECICE_NO_MPI
+  MPI_Comm comm = MPI_COMM_SELF;
+  return std::make_unique<precice::Participant>("SolverOne", config, 0, 1, &comm);
+#else
+  return std::make_unique<precice::Participant>("SolverOne", config, 0, 1);
+#endif
+}
+
+/**
+ * @brief Measures the registration of a mesh via the API of a participant.
+ *
+ * Every repetition constructs a new participant, the construction is not measured.
+ */
+void benchmarkRegistration(State &state, bool volume)
+{
+  const auto config = writeRegistrationConfig();
+
+  const int  verticesPerEdge = volume ? volumeVerticesPerEdge(state.options().vertices) : surfaceVerticesPerEdge(state.options().vertices);
+  const auto coordinates     = volume ? volumeCoordinates(verticesPerEdge, 0.0, 1.0) : surfaceCoordinates(verticesPerEdge);
+  const auto connectivity    = volume ? volumeTetrahedra(verticesPerEdge) : surfaceTriangles(verticesPerEdge);
+  const auto nVertices       = coordinates.size() / 3;
+  const auto nElements       = connectivity.size() / (volume ? 4 : 3);
+  state.setParameter("vertices", static_cast<long>(nVertices));
+  state.setParameter(volume ? "tetrahedra" : "triangles", static_cast<long>(nElements));
+
+  std::unique_ptr<precice::Participant> participant;
+  std::vector<VertexID>                 ids(nVertices);
+
+  state.measure(
+      "setMeshVertices", [&] {
+        participant.reset();
+        participant = constructSolverOne(config);
+      },
+      [&] { participant->setMeshVertices("MeshOne", coordinates, ids); }, nVertices);
+
+  state.measure(
+      volume ? "setMeshTetrahedra" : "setMeshTriangles", [&] {
+        participant.reset();
+        participant = constructSolverOne(config);
+        participant->setMeshVertices("MeshOne", coordinates, ids);
+      },
+      [&] {
+        if (volume) {
+          participant->setMeshTetrahedra("MeshOne", connectivity);
+        } else {
+          participant->setMeshTriangles("MeshOne", connectivity);
+        }
+      },
+      nElements);
+  participant.reset();
+}
+
+} // namespace
+
+void registerMeshBenchmarks()
+{
+  registerBenchmark("mesh/preprocess/surface", [](State &state) { benchmarkPreprocess(state, false); });
+  registerBenchmark("mesh/preprocess/volume", [](State &state) { benchmarkPreprocess(state, true); });
+  registerBenchmark("mesh/registration/surface", [](State &state) { benchmarkRegistration(state, false); });
+  registerBenchmark("mesh/registration/volume", [](State &state) { benchmarkRegistration(state, true); });
+}
+
+} // namespace precice::benchmarks
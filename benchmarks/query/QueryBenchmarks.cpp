@@ -0,0 +1,88 @@
+#include <Eigen/Core>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "Benchmark.hpp"
+#include "SyntheticMeshes.hpp"
+#include "mesh/Mesh.hpp"
+#include "mesh/Vertex.hpp"
+#include "query/Index.hpp"
+
+namespace precice::benchmarks {
+
+namespace {
+
+/// Prevents the compiler from removing the queries whose results are unused otherwise
+volatile std::size_t sink;
+
+/**
+ * @brief Compares the R-tree and the vertex grid for the vertex queries of the mappings.
+ *
+ * The meshes are regular grids, which is the best case for the vertex grid.
+ * Every vertex is queried once at a location offset by a third of the mesh width.
+ * The radius of the box queries spans 2.5 mesh widths, as done by compactly supported RBFs with few vertices per support.
+ * The phase `build` times the construction of the data structure including a first query,
+ * `radius` times getVerticesInsideBox() and `nearest` getClosestVertex().
+ */
+void benchmarkVertexQueries(State &state, query::Index::VertexBackend backend, bool volume)
+{
+  mesh::Mesh mesh("Mesh", 3, 0);
+
+  const int verticesPerEdge = volume ? volumeVerticesPerEdge(state.options().vertices) : surfaceVerticesPerEdge(state.options().vertices);
+  if (volume) {
+    fillVolumeMesh(mesh, verticesPerEdge, 0.0, 1.0, Connectivity::None);
+  } else {
+    fillSurfaceMesh(mesh, verticesPerEdge, Connectivity::None);
+  }
+  state.setParameter("vertices", static_cast<long>(mesh.nVertices()));
+
+  const double              h      = 1.0 / (verticesPerEdge - 1);
+  const double              radius = 2.5 * h;
+  std::vector<mesh::Vertex> probes;
+  probes.reserve(mesh.nVertices());
+  for (const auto &vertex : mesh.vertices()) {
+    probes.emplace_back(Eigen::VectorXd(vertex.getCoords().array() + h / 3), -1);
+  }
+  const double queries = probes.size();
+
+  query::Index index(mesh);
+  index.setVertexBackend(backend);
+
+  state.measure(
+      "build", [&] { index.clear(); },
+      [&] { sink = index.getVerticesInsideBox(probes.front(), radius).size(); });
+
+  state.measure(
+      "radius", [&] {
+        std::size_t found = 0;
+        for (const auto &probe : probes) {
+          found += index.getVerticesInsideBox(probe, radius).size();
+        }
+        sink = found;
+      },
+      queries);
+
+  state.measure(
+      "nearest", [&] {
+        std::size_t sum = 0;
+        for (const auto &probe : probes) {
+          sum += index.getClosestVertex(probe.getCoords()).index;
+        }
+        sink = sum;
+      },
+      queries);
+}
+
+} // namespace
+
+void registerQueryBenchmarks()
+{
+  using Backend = query::Index::VertexBackend;
+  registerBenchmark("query/rtree/surface", [](State &state) { benchmarkVertexQueries(state, Backend::RTree, false); });
+  registerBenchmark("query/rtree/volume", [](State &state) { benchmarkVertexQueries(state, Backend::RTree, true); });
+  registerBenchmark("query/vertex-grid/surface", [](State &state) { benchmarkVertexQueries(state, Backend::Grid, false); });
+  registerBenchmark("query/vertex-grid/volume", [](State &state) { benchmarkVertexQueries(state, Backend::Grid, true); });
+}
+
+} // namespace precice::benchmarks
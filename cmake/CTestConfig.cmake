@@ -241,6 +241,11 @@ add_precice_test(
   ARGUMENTS "--run_test=IOTests"
   TIMEOUT ${PRECICE_TEST_TIMEOUT_SHORT}
   )
+add_precice_test(
+  NAME logging
+  ARGUMENTS "--run_test=LoggingTests"
+  TIMEOUT ${PRECICE_TEST_TIMEOUT_SHORT}
+  )
 add_precice_test(
   NAME m2n
   ARGUMENTS "--run_test=M2NTests:\!M2NTests/MPIPorts:\!M2NTets/MPISinglePorts"
@@ -363,6 +368,13 @@ foreach(testsuite IN LISTS PRECICE_TEST_SUITES)
     )
 endforeach()
 
+# The asynchronous advance completes the coupling in a separate thread, which requires MPI_THREAD_MULTIPLE
+add_precice_test(
+  NAME "integration.Serial.AsyncAdvanceThreaded"
+  ARGUMENTS "--run_test=Integration/Serial/AsyncAdvance/TestAsyncAdvanceThreaded;--mpi-thread-multiple"
+  TIMEOUT ${PRECICE_TEST_TIMEOUT_LONG}
+  )
+
 add_precice_test_build_solverdummy(cpp)
 add_precice_test_build_solverdummy(c)
 add_precice_test_build_solverdummy(fortran)
@@ -452,6 +464,41 @@ if(PRECICE_BUILD_TOOLS)
     )
 endif()
 
+# Add tests for precice-bench
+
+if(PRECICE_BUILD_BENCHMARKS)
+  message(STATUS "Test precice.bench.list")
+  add_test(NAME precice.bench.list
+    COMMAND precice-bench --list
+    )
+  set_tests_properties(precice.bench.list PROPERTIES TIMEOUT ${PRECICE_TEST_TIMEOUT_SHORT} LABELS "bench;bin" PASS_REGULAR_EXPRESSION "mapping/rbf-global-direct/gaussian/surface")
+
+  # Runs all benchmarks once on tiny meshes to catch failing setups
+  message(STATUS "Test precice.bench.smoke")
+  file(MAKE_DIRECTORY "${PRECICE_TEST_DIR}/bench.smoke")
+  add_test(NAME precice.bench.smoke
+    COMMAND precice-bench --vertices 30 --repetitions 1 --warmup 0 --output results.json
+    WORKING_DIRECTORY "${PRECICE_TEST_DIR}/bench.smoke"
+    )
+  set_tests_properties(precice.bench.smoke PROPERTIES TIMEOUT ${PRECICE_TEST_TIMEOUT_LONG} LABELS "bench;bin")
+
+  # Runs the communication and coupling benchmarks, which require at least 2 MPI ranks
+  if(PRECICE_FEATURE_MPI_COMMUNICATION)
+    message(STATUS "Test precice.bench.parallel")
+    file(MAKE_DIRECTORY "${PRECICE_TEST_DIR}/bench.parallel")
+    set(_precice_oversubscribe "--map-by;:OVERSUBSCRIBE")
+    if(MPI_CXX_LIBRARY_VERSION_STRING MATCHES "Intel")
+      set(_precice_oversubscribe "")
+    endif()
+    add_test(NAME precice.bench.parallel
+      COMMAND ${MPIEXEC_EXECUTABLE} ${MPIEXEC_NUMPROC_FLAG} 2 ${_precice_oversubscribe} ${PRECICE_CTEST_MPI_FLAGS} ${MPIEXEC_PREFLAGS} $<TARGET_FILE:precice-bench> ${MPIEXEC_POSTFLAGS} --filter "^com/|^m2n/|^coupling/.*/nearest-neighbor" --vertices 30 --time-windows 2 --repetitions 1 --warmup 0 --output results.json
+      WORKING_DIRECTORY "${PRECICE_TEST_DIR}/bench.parallel"
+      )
+    unset(_precice_oversubscribe)
+    set_tests_properties(precice.bench.parallel PROPERTIES TIMEOUT ${PRECICE_TEST_TIMEOUT_LONG} LABELS "bench;bin")
+  endif()
+endif()
+
 # Add a separate target to test only the base
 add_custom_target(
   test_base
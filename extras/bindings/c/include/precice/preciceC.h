@@ -327,6 +327,71 @@ PRECICE_API void precicec_readData(
 
 ///@}
 
+///@name Handle-based Access
+///@{
+
+/**
+ * @brief See precice::Participant::getMeshHandle().
+ */
+PRECICE_API int precicec_getMeshHandle(const char *meshName);
+
+/**
+ * @brief See precice::Participant::getDataHandle().
+ */
+PRECICE_API int precicec_getDataHandle(const char *meshName, const char *dataName);
+
+/**
+ * @brief Creates multiple mesh vertices on the mesh with the given handle.
+ *
+ * @param[in] meshHandle the handle of the mesh from precicec_getMeshHandle()
+ * @param[in] size Number of vertices to be set.
+ * @param[in] positions Pointer to an array holding the coordinates of the vertices.
+ * @param[out] ids Pointer to an array of size "size" receiving the IDs of the vertices.
+ *
+ * @see Participant::setMeshVertices
+ */
+PRECICE_API void precicec_setMeshVerticesWithHandle(
+    int           meshHandle,
+    int           size,
+    const double *positions,
+    int *         ids);
+
+/**
+ * @brief Writes data values given as block to the data with the given handle.
+ *
+ * @param[in] dataHandle the handle of the data from precicec_getDataHandle()
+ * @param[in] size Number of indices, and number of values * dimensions.
+ * @param[in] valueIndices Indices of the vertices.
+ * @param[in] values Values of the data to be written.
+ *
+ * @see Participant::writeData
+ */
+PRECICE_API void precicec_writeDataWithHandle(
+    int           dataHandle,
+    int           size,
+    const int *   valueIndices,
+    const double *values);
+
+/**
+ * @brief Reads data values given as block from the data with the given handle.
+ *
+ * @param[in] dataHandle the handle of the data from precicec_getDataHandle()
+ * @param[in] size  Number of indices, and number of values * dimensions.
+ * @param[in] valueIndices Indices of the vertices.
+ * @param[in] relativeReadTime Point in time where data is read relative to the beginning of the current time step.
+ * @param[out] values Values of the data to be read.
+ *
+ * @see Participant::readData
+ */
+PRECICE_API void precicec_readDataWithHandle(
+    int         dataHandle,
+    int         size,
+    const int * valueIndices,
+    double      relativeReadTime,
+    double *    values);
+
+///@}
+
 ///@name Direct mesh access
 ///@{
 
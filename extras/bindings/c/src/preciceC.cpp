@@ -333,6 +333,68 @@ try {
   std::abort();
 }
 
+int precicec_getMeshHandle(const char *meshName)
+try {
+  PRECICE_CHECK(impl != nullptr, errormsg);
+  return impl->getMeshHandle(meshName).id;
+} catch (::precice::Error &e) {
+  std::abort();
+  return -1;
+}
+
+int precicec_getDataHandle(const char *meshName, const char *dataName)
+try {
+  PRECICE_CHECK(impl != nullptr, errormsg);
+  return impl->getDataHandle(meshName, dataName).id;
+} catch (::precice::Error &e) {
+  std::abort();
+  return -1;
+}
+
+void precicec_setMeshVerticesWithHandle(
+    int           meshHandle,
+    int           size,
+    const double *positions,
+    int *         ids)
+try {
+  PRECICE_CHECK(impl != nullptr, errormsg);
+  const precice::MeshHandle handle{meshHandle};
+  auto                      idsSize = static_cast<long unsigned>(size);
+  auto                      posSize = static_cast<long unsigned>(impl->getMeshDimensions(handle) * size);
+  impl->setMeshVertices(handle, {positions, posSize}, {ids, idsSize});
+} catch (::precice::Error &e) {
+  std::abort();
+}
+
+void precicec_writeDataWithHandle(
+    int           dataHandle,
+    int           size,
+    const int *   valueIndices,
+    const double *values)
+try {
+  PRECICE_CHECK(impl != nullptr, errormsg);
+  const precice::DataHandle handle{dataHandle};
+  auto                      dataSize = size * impl->getDataDimensions(handle);
+  impl->writeData(handle, {valueIndices, static_cast<unsigned long>(size)}, {values, static_cast<unsigned long>(dataSize)});
+} catch (::precice::Error &e) {
+  std::abort();
+}
+
+void precicec_readDataWithHandle(
+    int         dataHandle,
+    int         size,
+    const int * valueIndices,
+    double      relativeReadTime,
+    double *    values)
+try {
+  PRECICE_CHECK(impl != nullptr, errormsg);
+  const precice::DataHandle handle{dataHandle};
+  auto                      dataSize = size * impl->getDataDimensions(handle);
+  impl->readData(handle, {valueIndices, static_cast<unsigned long>(size)}, relativeReadTime, {values, static_cast<unsigned long>(dataSize)});
+} catch (::precice::Error &e) {
+  std::abort();
+}
+
 int precicec_requiresGradientDataFor(const char *meshName,
                                      const char *dataName)
 try {
@@ -498,6 +498,110 @@ PRECICE_API void precicef_read_data_(
 
 ///@}
 
+///@name Handle-based Access
+///@{
+
+/**
+ * Fortran syntax:
+ * precicef_get_mesh_handle_(
+ *   CHARACTER meshName(*),
+ *   INTEGER   meshHandle)
+ *
+ * IN:  mesh, meshNameLength
+ * OUT: meshHandle
+ *
+ * @copydoc precice::Participant::getMeshHandle()
+ *
+ */
+PRECICE_API void precicef_get_mesh_handle_(
+    const char *meshName,
+    int *       meshHandle,
+    int         meshNameLength);
+
+/**
+ * Fortran syntax:
+ * precicef_get_data_handle_(
+ *   CHARACTER meshName(*),
+ *   CHARACTER dataName(*),
+ *   INTEGER   dataHandle)
+ *
+ * IN:  mesh, data, meshNameLength, dataNameLength
+ * OUT: dataHandle
+ *
+ * @copydoc precice::Participant::getDataHandle()
+ *
+ */
+PRECICE_API void precicef_get_data_handle_(
+    const char *meshName,
+    const char *dataName,
+    int *       dataHandle,
+    int         meshNameLength,
+    int         dataNameLength);
+
+/**
+ * Fortran syntax:
+ * precicef_set_vertices_with_handle(
+ *   INTEGER          meshHandle,
+ *   INTEGER          size,
+ *   DOUBLE PRECISION coordinates(dim*size),
+ *   INTEGER          ids(size) )
+ *
+ * IN:  meshHandle, size, coordinates
+ * OUT: ids
+ *
+ * @copydoc precice::Participant::setMeshVertices(MeshHandle, ::precice::span<const double>, ::precice::span<VertexID>)
+ *
+ */
+PRECICE_API void precicef_set_vertices_with_handle_(
+    const int *meshHandle,
+    const int *size,
+    double *   coordinates,
+    int *      ids);
+
+/**
+ * Fortran syntax:
+ * precicef_write_data_with_handle(
+ *   INTEGER          dataHandle,
+ *   INTEGER          size,
+ *   INTEGER          ids(size),
+ *   DOUBLE PRECISION values(dim*size) )
+ *
+ * IN:  dataHandle, size, ids, values
+ * OUT: -
+ *
+ * @copydoc precice::Participant::writeData(DataHandle, ::precice::span<const VertexID>, ::precice::span<const double>)
+ *
+ */
+PRECICE_API void precicef_write_data_with_handle_(
+    const int *dataHandle,
+    const int *size,
+    int *      ids,
+    double *   values);
+
+/**
+ * Fortran syntax:
+ * precicef_read_data_with_handle(
+ *   INTEGER          dataHandle,
+ *   INTEGER          size,
+ *   INTEGER          ids(size),
+ *   DOUBLE PRECISION relativeReadTime,
+ *   DOUBLE PRECISION values(dim*size) )
+ *
+ * IN:  dataHandle, size, ids, relativeReadTime
+ * OUT: values
+ *
+ * @copydoc precice::Participant::readData(DataHandle, ::precice::span<const VertexID>, double, ::precice::span<double>) const
+ *
+ */
+PRECICE_API void precicef_read_data_with_handle_(
+    const int *   dataHandle,
+    const int *   size,
+    int *         ids,
+    const double *relativeReadTime,
+    double *      values);
+
+///@}
+
 ///@name Direct mesh access
 ///@{
 
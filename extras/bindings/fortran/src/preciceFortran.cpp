@@ -372,6 +372,79 @@ try {
   std::abort();
 }
 
+void precicef_get_mesh_handle_(
+    const char *meshName,
+    int *       meshHandle,
+    int         meshNameLength)
+try {
+  PRECICE_CHECK(impl != nullptr, errormsg);
+  *meshHandle = impl->getMeshHandle(precice::impl::strippedStringView(meshName, meshNameLength)).id;
+} catch (::precice::Error &e) {
+  std::abort();
+}
+
+void precicef_get_data_handle_(
+    const char *meshName,
+    const char *dataName,
+    int *       dataHandle,
+    int         meshNameLength,
+    int         dataNameLength)
+try {
+  PRECICE_CHECK(impl != nullptr, errormsg);
+  *dataHandle = impl->getDataHandle(precice::impl::strippedStringView(meshName, meshNameLength), precice::impl::strippedStringView(dataName, dataNameLength)).id;
+} catch (::precice::Error &e) {
+  std::abort();
+}
+
+void precicef_set_vertices_with_handle_(
+    const int *meshHandle,
+    const int *size,
+    double *   coordinates,
+    int *      ids)
+try {
+  PRECICE_CHECK(impl != nullptr, errormsg);
+  const precice::MeshHandle handle{*meshHandle};
+  auto                      positionSize = static_cast<unsigned long>(impl->getMeshDimensions(handle) * *size);
+  impl->setMeshVertices(handle, {coordinates, positionSize}, {ids, static_cast<unsigned long>(*size)});
+} catch (::precice::Error &e) {
+  std::abort();
+}
+
+void precicef_write_data_with_handle_(
+    const int *dataHandle,
+    const int *size,
+    int *      ids,
+    double *   values)
+try {
+  PRECICE_CHECK(impl != nullptr, errormsg);
+  const precice::DataHandle handle{*dataHandle};
+  auto                      dataSize = *size * impl->getDataDimensions(handle);
+  impl->writeData(handle,
+                  {ids, static_cast<unsigned long>(*size)},
+                  {values, static_cast<unsigned long>(dataSize)});
+} catch (::precice::Error &e) {
+  std::abort();
+}
+
+void precicef_read_data_with_handle_(
+    const int *   dataHandle,
+    const int *   size,
+    int *         ids,
+    const double *relativeReadTime,
+    double *      values)
+try {
+  PRECICE_CHECK(impl != nullptr, errormsg);
+  const precice::DataHandle handle{*dataHandle};
+  auto                      dataSize = *size * impl->getDataDimensions(handle);
+  impl->readData(
+      handle,
+      {ids, static_cast<unsigned long>(*size)},
+      *relativeReadTime,
+      {values, static_cast<unsigned long>(dataSize)});
+} catch (::precice::Error &e) {
+  std::abort();
+}
+
 int precice::impl::strippedLength(
     const char *string,
     int         length)
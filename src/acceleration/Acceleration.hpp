@@ -1,19 +1,13 @@
 #pragma once
 
 #include <Eigen/Core>
+#include <iosfwd>
 #include <map>
 #include <vector>
 
 #include "cplscheme/BaseCouplingScheme.hpp"
 #include "cplscheme/SharedPointer.hpp"
 
-namespace precice {
-namespace io {
-class TXTWriter;
-class TXTReader;
-} // namespace io
-} // namespace precice
-
 namespace precice {
 namespace acceleration {
 
@@ -38,9 +32,11 @@ public:
 
   virtual void iterationsConverged(const DataMap &cpldata) = 0;
 
-  virtual void exportState(io::TXTWriter &writer) {}
+  /// Writes the state which is carried over between time windows to a binary stream
+  virtual void exportState(std::ostream &out) {}
 
-  virtual void importState(io::TXTReader &reader) {}
+  /// Restores the state written by exportState(), must be called after initialize()
+  virtual void importState(std::istream &in) {}
 
   /// Gives the number of QN columns that where filtered out (i.e. deleted) in this time window
   virtual int getDeletedColumns() const
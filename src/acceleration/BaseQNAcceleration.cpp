@@ -2,9 +2,11 @@
 #include <Eigen/Core>
 #include <boost/range/adaptor/map.hpp>
 #include <cmath>
+#include <fstream>
 #include <memory>
 #include <utility>
 
+#include "acceleration/impl/BinaryState.hpp"
 #include "acceleration/impl/Preconditioner.hpp"
 #include "acceleration/impl/QRFactorization.hpp"
 #include "com/Communication.hpp"
@@ -20,12 +22,16 @@
 #include "utils/assertion.hpp"
 
 namespace precice {
-namespace io {
-class TXTReader;
-class TXTWriter;
-} // namespace io
 namespace acceleration {
 
+namespace {
+/// Identifies files written by BaseQNAcceleration::exportState()
+const std::string STATE_MAGIC{"preCICE-QN-state"};
+
+/// Version of the binary state layout, to be increased on every change
+constexpr int STATE_VERSION = 1;
+} // namespace
+
 /* ----------------------------------------------------------------------------
  *     Constructor
  * ----------------------------------------------------------------------------
@@ -185,6 +191,8 @@ void BaseQNAcceleration::initialize(
   _qrV.setGlobalRows(getPrimaryLSSystemRows());
 
   _preconditioner->initialize(subVectorSizes);
+
+  _restorePending = _restartFromCheckpoint;
 }
 
 /** ---------------------------------------------------------------------------------------------
@@ -297,6 +305,10 @@ void BaseQNAcceleration::performAcceleration(
 {
   PRECICE_TRACE(_primaryDataIDs.size(), cplData.size());
 
+  if (_restorePending) {
+    readCheckpoint();
+  }
+
   profiling::Event e("cpl.computeQuasiNewtonUpdate", profiling::Synchronize);
 
   PRECICE_ASSERT(_oldPrimaryResiduals.size() == _oldPrimaryXTilde.size(), _oldPrimaryResiduals.size(), _oldPrimaryXTilde.size());
@@ -484,6 +496,10 @@ void BaseQNAcceleration::iterationsConverged(
 {
   PRECICE_TRACE();
 
+  if (_restorePending) {
+    readCheckpoint();
+  }
+
   if (utils::IntraComm::isPrimary() || !utils::IntraComm::isParallel())
     _infostringstream << "# time window " << tWindows << " converged #\n iterations: " << its
                       << "\n used cols: " << getLSSystemCols() << "\n del cols: " << _nbDelCols << '\n';
@@ -562,6 +578,10 @@ void BaseQNAcceleration::iterationsConverged(
 
   _matrixCols.push_front(0);
   _firstIteration = true;
+
+  if (_checkpointInterval > 0 && tWindows % _checkpointInterval == 0) {
+    writeCheckpoint();
+  }
 }
 
 /** ---------------------------------------------------------------------------------------------
@@ -599,13 +619,122 @@ void BaseQNAcceleration::removeMatrixColumn(
 }
 
 void BaseQNAcceleration::exportState(
-    io::TXTWriter &writer)
+    std::ostream &out)
 {
+  PRECICE_TRACE(tWindows, _matrixV.cols());
+
+  impl::writeBinary(out, STATE_MAGIC);
+  impl::writeBinary(out, STATE_VERSION);
+  impl::writeBinary(out, static_cast<int>(_primaryResiduals.size()));
+  impl::writeBinary(out, static_cast<int>(_residuals.size()));
+
+  impl::writeBinary(out, tWindows);
+  impl::writeBinary(out, _firstTimeWindow);
+  impl::writeBinary(out, _resetLS);
+  impl::writeBinary(out, _matrixV);
+  impl::writeBinary(out, _matrixW);
+  impl::writeBinary(out, _matrixCols);
+  impl::writeBinary(out, _matrixVBackup);
+  impl::writeBinary(out, _matrixWBackup);
+  impl::writeBinary(out, _matrixColsBackup);
+  _qrV.exportState(out);
+  _preconditioner->exportState(out);
+
+  exportSpecializedState(out);
 }
 
 void BaseQNAcceleration::importState(
-    io::TXTReader &reader)
+    std::istream &in)
 {
+  PRECICE_TRACE();
+
+  std::string magic;
+  int         version = 0;
+  impl::readBinary(in, magic);
+  PRECICE_CHECK(magic == STATE_MAGIC, "The imported data is no quasi-Newton acceleration state.");
+  impl::readBinary(in, version);
+  PRECICE_CHECK(version == STATE_VERSION,
+                "The quasi-Newton acceleration state has version {}, but this version of preCICE expects version {}.",
+                version, STATE_VERSION);
+
+  int primaryRows = 0;
+  int rows        = 0;
+  impl::readBinary(in, primaryRows);
+  impl::readBinary(in, rows);
+  PRECICE_CHECK(primaryRows == _primaryResiduals.size() && rows == _residuals.size(),
+                "The quasi-Newton acceleration state was written for {} primary and {} total coupling data entries on this rank, "
+                "but the current coupling data has {} primary and {} total entries. "
+                "The state can only be imported for identical coupling data and an identical partitioning of the coupling meshes.",
+                primaryRows, rows, _primaryResiduals.size(), _residuals.size());
+
+  impl::readBinary(in, tWindows);
+  impl::readBinary(in, _firstTimeWindow);
+  impl::readBinary(in, _resetLS);
+  impl::readBinary(in, _matrixV);
+  impl::readBinary(in, _matrixW);
+  impl::readBinary(in, _matrixCols);
+  impl::readBinary(in, _matrixVBackup);
+  impl::readBinary(in, _matrixWBackup);
+  impl::readBinary(in, _matrixColsBackup);
+  _qrV.importState(in);
+  _preconditioner->importState(in);
+
+  importSpecializedState(in);
+
+  PRECICE_CHECK(in.peek() == std::istream::traits_type::eof(),
+                "The quasi-Newton acceleration state contains trailing data. "
+                "It was probably written by a differently configured acceleration scheme.");
+
+  its             = 0;
+  _firstIteration = true;
+  _restorePending = false;
+}
+
+void BaseQNAcceleration::setStateCheckpointing(
+    int         interval,
+    std::string filePrefix,
+    bool        restart)
+{
+  PRECICE_CHECK(interval >= 0,
+                "The interval of the quasi-Newton state checkpoints has to be larger than or equal to zero. "
+                "Current interval is {}",
+                interval);
+  _checkpointInterval    = interval;
+  _checkpointFilePrefix  = std::move(filePrefix);
+  _restartFromCheckpoint = restart;
+}
+
+std::string BaseQNAcceleration::getCheckpointFileName() const
+{
+  return fmt::format("{}-{}.bin", _checkpointFilePrefix, utils::IntraComm::getRank());
+}
+
+void BaseQNAcceleration::writeCheckpoint()
+{
+  PRECICE_TRACE(tWindows);
+  profiling::Event e("cpl.writeQuasiNewtonState");
+
+  const auto    fileName = getCheckpointFileName();
+  std::ofstream out(fileName, std::ios::binary | std::ios::trunc);
+  PRECICE_CHECK(out, "Could not open the quasi-Newton state checkpoint file \"{}\" for writing.", fileName);
+  exportState(out);
+  out.close();
+  PRECICE_CHECK(out, "Writing the quasi-Newton state checkpoint file \"{}\" failed.", fileName);
+  PRECICE_DEBUG("Wrote quasi-Newton state of time window {} with {} columns to \"{}\"", tWindows, _matrixV.cols(), fileName);
+}
+
+void BaseQNAcceleration::readCheckpoint()
+{
+  PRECICE_TRACE();
+  profiling::Event e("cpl.readQuasiNewtonState");
+
+  const auto    fileName = getCheckpointFileName();
+  std::ifstream in(fileName, std::ios::binary);
+  PRECICE_CHECK(in, "Could not open the quasi-Newton state checkpoint file \"{}\" to restart the acceleration. "
+                    "Please check that the file exists or disable the restart in the checkpoint tag of the acceleration.",
+                fileName);
+  importState(in);
+  PRECICE_INFO("Restored quasi-Newton state of time window {} with {} columns from \"{}\"", tWindows, _matrixV.cols(), fileName);
 }
 
 int BaseQNAcceleration::getDeletedColumns() const
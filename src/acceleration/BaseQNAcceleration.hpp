@@ -49,11 +49,6 @@
 // ----------------------------------------------------------- CLASS DEFINITION
 
 namespace precice {
-namespace io {
-class TXTReader;
-class TXTWriter;
-} // namespace io
-
 namespace acceleration {
 
 /**
@@ -114,16 +109,29 @@ public:
   virtual void iterationsConverged(const DataMap &cplData) override final;
 
   /**
-   * @brief Exports the current state of the acceleration to a file.
+   * @brief Exports the state of the acceleration which is carried over between time windows.
+   *
+   * This comprises the V, W matrices, the QR decomposition of V, the preconditioner weights,
+   * the time window counter and the specialized state of IQN-IMVJ.
+   * The state is local to this rank and should be exported after iterationsConverged().
+   */
+  virtual void exportState(std::ostream &out) override final;
+
+  /**
+   * @brief Imports a state written by exportState().
+   *
+   * Requires the acceleration to be initialized with an identical partitioning of the coupling data.
    */
-  virtual void exportState(io::TXTWriter &writer) override final;
+  virtual void importState(std::istream &in) override final;
 
   /**
-   * @brief Imports the last exported state of the acceleration from file.
+   * @brief Enables periodic checkpointing of the state to the files <filePrefix>-<rank>.bin
    *
-   * Is empty at the moment!!!
+   * @param[in] interval Number of time windows between checkpoints, 0 disables writing
+   * @param[in] filePrefix Prefix of the per-rank checkpoint files
+   * @param[in] restart If true, the state is restored from the checkpoint files before the first iteration
    */
-  virtual void importState(io::TXTReader &reader) override final;
+  void setStateCheckpointing(int interval, std::string filePrefix, bool restart);
 
   /// how many QN columns were deleted in this time window
   virtual int getDeletedColumns() const override final;
@@ -267,6 +275,12 @@ protected:
   /// Removes one iteration from V,W matrices and adapts _matrixCols.
   virtual void removeMatrixColumn(int columnIndex);
 
+  /// Exports the state of the specialized acceleration scheme, called by exportState()
+  virtual void exportSpecializedState(std::ostream &) {}
+
+  /// Imports the state of the specialized acceleration scheme, called by importState()
+  virtual void importSpecializedState(std::istream &) {}
+
   /// Writes info to the _infostream (also in parallel)
   void writeInfo(const std::string &s, bool allProcs = false);
 
@@ -305,6 +319,27 @@ private:
 
   /// Number of dropped columns in this time window (old time window out of scope)
   int _nbDropCols = 0;
+
+  /// Number of time windows between two state checkpoints, 0 if no checkpoints are written
+  int _checkpointInterval = 0;
+
+  /// Prefix of the per-rank state checkpoint files
+  std::string _checkpointFilePrefix;
+
+  /// True if the state still needs to be restored from the checkpoint files
+  bool _restorePending = false;
+
+  /// True if the state is restored from the checkpoint files after initialization
+  bool _restartFromCheckpoint = false;
+
+  /// Returns the name of the state checkpoint file of this rank
+  std::string getCheckpointFileName() const;
+
+  /// Writes the state to the checkpoint file of this rank
+  void writeCheckpoint();
+
+  /// Restores the state from the checkpoint file of this rank
+  void readCheckpoint();
 };
 } // namespace acceleration
 } // namespace precice
@@ -9,6 +9,7 @@
 #include <utility>
 
 #include "acceleration/IQNIMVJAcceleration.hpp"
+#include "acceleration/impl/BinaryState.hpp"
 #include "acceleration/impl/ParallelMatrixOperations.hpp"
 #include "acceleration/impl/Preconditioner.hpp"
 #include "acceleration/impl/QRFactorization.hpp"
@@ -53,6 +54,7 @@ IQNIMVJAcceleration::IQNIMVJAcceleration(
       _matrixV_RSLS(),
       _matrixW_RSLS(),
       _matrixCols_RSLS(),
+      _lowRankCols(0),
       _parMatrixOps(nullptr),
       _svdJ(RSSVDtruncationEps, preconditioner),
       _alwaysBuildJacobian(alwaysBuildJacobian),
@@ -159,13 +161,13 @@ void IQNIMVJAcceleration::updateDifferenceMatrices(
         // iterate over all stored Wtil and Z matrices in current chunk
         if (_imvjRestart) {
           for (int i = 0; i < static_cast<int>(_WtilChunk.size()); i++) {
-            int colsLSSystemBackThen = _pseudoInverseChunk[i].rows();
-            PRECICE_ASSERT(colsLSSystemBackThen == _WtilChunk[i].cols(), colsLSSystemBackThen, _WtilChunk[i].cols());
+            int colsLSSystemBackThen = usedChunkCols(i);
+            PRECICE_ASSERT(_pseudoInverseChunk[i].rows() == _WtilChunk[i].cols(), _pseudoInverseChunk[i].rows(), _WtilChunk[i].cols());
             Eigen::VectorXd Zv = Eigen::VectorXd::Zero(colsLSSystemBackThen);
             // multiply: Zv := Z^q * V(:,0) of size (m x 1)
-            _parMatrixOps->multiply(_pseudoInverseChunk[i], v, Zv, colsLSSystemBackThen, getLSSystemRows(), 1);
+            _parMatrixOps->multiply(_pseudoInverseChunk[i].topRows(colsLSSystemBackThen), v, Zv, colsLSSystemBackThen, getLSSystemRows(), 1);
             // multiply: Wtil^q * Zv  dimensions: (n x m) * (m x 1), fully local
-            wtil += _WtilChunk[i] * Zv;
+            wtil += _WtilChunk[i].leftCols(colsLSSystemBackThen) * Zv;
           }
 
           // store columns if restart mode = RS-LS
@@ -277,13 +279,13 @@ void IQNIMVJAcceleration::buildWtil()
   // iterate over all stored Wtil and Z matrices in current chunk
   if (_imvjRestart) {
     for (int i = 0; i < static_cast<int>(_WtilChunk.size()); i++) {
-      int colsLSSystemBackThen = _pseudoInverseChunk[i].rows();
-      PRECICE_ASSERT(colsLSSystemBackThen == _WtilChunk[i].cols(), colsLSSystemBackThen, _WtilChunk[i].cols());
+      int colsLSSystemBackThen = usedChunkCols(i);
+      PRECICE_ASSERT(_pseudoInverseChunk[i].rows() == _WtilChunk[i].cols(), _pseudoInverseChunk[i].rows(), _WtilChunk[i].cols());
       Eigen::MatrixXd ZV = Eigen::MatrixXd::Zero(colsLSSystemBackThen, _qrV.cols());
       // multiply: ZV := Z^q * V of size (m x m) with m=#cols, stored on each proc.
-      _parMatrixOps->multiply(_pseudoInverseChunk[i], _matrixV, ZV, colsLSSystemBackThen, getLSSystemRows(), _qrV.cols());
+      _parMatrixOps->multiply(_pseudoInverseChunk[i].topRows(colsLSSystemBackThen), _matrixV, ZV, colsLSSystemBackThen, getLSSystemRows(), _qrV.cols());
       // multiply: Wtil^q * ZV  dimensions: (n x m) * (m x m), fully local and embarrassingly parallel
-      _Wtil += _WtilChunk[i] * ZV;
+      _Wtil += _WtilChunk[i].leftCols(colsLSSystemBackThen) * ZV;
     }
 
     // imvj without restart is used, i.e., recompute Wtil: Wtil = W - J_prev * V
@@ -414,13 +416,13 @@ void IQNIMVJAcceleration::computeNewtonUpdateEfficient(Eigen::VectorXd &xUpdate)
    */
   if (_imvjRestart) {
     for (int i = 0; i < static_cast<int>(_WtilChunk.size()); i++) {
-      int colsLSSystemBackThen = _pseudoInverseChunk[i].rows();
-      PRECICE_ASSERT(colsLSSystemBackThen == _WtilChunk[i].cols(), colsLSSystemBackThen, _WtilChunk[i].cols());
+      int colsLSSystemBackThen = usedChunkCols(i);
+      PRECICE_ASSERT(_pseudoInverseChunk[i].rows() == _WtilChunk[i].cols(), _pseudoInverseChunk[i].rows(), _WtilChunk[i].cols());
       r_til = Eigen::VectorXd::Zero(colsLSSystemBackThen);
       // multiply: r_til := Z^q * (-res) of size (m x 1) with m=#cols of LS at that time, result stored on each proc.
-      _parMatrixOps->multiply(_pseudoInverseChunk[i], negativeResiduals, r_til, colsLSSystemBackThen, getLSSystemRows(), 1);
+      _parMatrixOps->multiply(_pseudoInverseChunk[i].topRows(colsLSSystemBackThen), negativeResiduals, r_til, colsLSSystemBackThen, getLSSystemRows(), 1);
       // multiply: Wtil^q * r_til  dimensions: (n x m) * (m x 1), fully local and embarrassingly parallel
-      xUpdate += _WtilChunk[i] * r_til;
+      xUpdate += _WtilChunk[i].leftCols(colsLSSystemBackThen) * r_til;
     }
 
     // imvj without restart is used, i.e., compute directly J_prev * (-res)
@@ -730,13 +732,17 @@ void IQNIMVJAcceleration::specializedIterationsConverged(
 
       // push back unscaled pseudo Inverse, Wtil is also unscaled.
       // all objects in Wtil chunk and Z chunk are NOT PRECONDITIONED
-      _WtilChunk.push_back(_Wtil);
-      _pseudoInverseChunk.push_back(Z);
+      if (_imvjRestartType == LOW_RANK) {
+        appendLowRankUpdate(Z);
+      } else {
+        _WtilChunk.push_back(_Wtil);
+        _pseudoInverseChunk.push_back(Z);
+      }
 
       /**
        *  Restart the IMVJ according to restart type
        */
-      if (static_cast<int>(_WtilChunk.size()) >= _chunkSize + 1) {
+      if (_imvjRestartType != LOW_RANK && static_cast<int>(_WtilChunk.size()) >= _chunkSize + 1) {
 
         // < RESTART >
         _nbRestarts++;
@@ -769,6 +775,105 @@ void IQNIMVJAcceleration::specializedIterationsConverged(
   }
 }
 
+// ==================================================================================
+void IQNIMVJAcceleration::appendLowRankUpdate(
+    const Eigen::MatrixXd &Z)
+{
+  PRECICE_TRACE(_Wtil.cols());
+  PRECICE_ASSERT(_Wtil.cols() == Z.rows(), _Wtil.cols(), Z.rows());
+  PRECICE_ASSERT(_Wtil.cols() <= _maxIterationsUsed, _Wtil.cols(), _maxIterationsUsed);
+
+  // J_prev + Wtil * Z = [Wtil^0, Wtil] * [Z^0; Z], all applications of J_prev then only need
+  // one local GEMM with each factor and a single allreduce of the small product Z^0 * v.
+  // All time windows are kept, hence, the representation is exact. The capacity of the factors grows
+  // geometrically, such that appending a time window only rarely reallocates them.
+  if (_WtilChunk.empty()) {
+    _WtilChunk.emplace_back(Eigen::MatrixXd::Zero(_Wtil.rows(), _maxIterationsUsed));
+    _pseudoInverseChunk.emplace_back(Eigen::MatrixXd::Zero(_maxIterationsUsed, Z.cols()));
+  }
+  PRECICE_ASSERT(_WtilChunk.size() == 1 && _pseudoInverseChunk.size() == 1, _WtilChunk.size(), _pseudoInverseChunk.size());
+
+  Eigen::MatrixXd &W0 = _WtilChunk.front();
+  Eigen::MatrixXd &Z0 = _pseudoInverseChunk.front();
+
+  const int rank = _lowRankCols;
+  if (const int required = rank + _Wtil.cols(); required > W0.cols()) {
+    const int capacity = std::max<int>(2 * W0.cols(), required);
+    W0.conservativeResizeLike(Eigen::MatrixXd::Zero(W0.rows(), capacity));
+    Z0.conservativeResizeLike(Eigen::MatrixXd::Zero(capacity, Z0.cols()));
+  }
+
+  W0.middleCols(rank, _Wtil.cols()) = _Wtil;
+  Z0.middleRows(rank, Z.rows())     = Z;
+  _lowRankCols += _Wtil.cols();
+
+  PRECICE_DEBUG("Low-rank representation of the inverse Jacobian has rank {} and capacity {}", _lowRankCols, W0.cols());
+}
+
+// ==================================================================================
+int IQNIMVJAcceleration::usedChunkCols(
+    int q) const
+{
+  if (_imvjRestartType == LOW_RANK) {
+    return _lowRankCols;
+  }
+  return _WtilChunk[q].cols();
+}
+
+// ==================================================================================
+void IQNIMVJAcceleration::exportSpecializedState(
+    std::ostream &out)
+{
+  PRECICE_TRACE();
+  impl::writeBinary(out, _imvjRestartType);
+  impl::writeBinary(out, _oldInvJacobian);
+  impl::writeBinary(out, _Wtil);
+  impl::writeBinary(out, _WtilChunk);
+  impl::writeBinary(out, _pseudoInverseChunk);
+  impl::writeBinary(out, _lowRankCols);
+  impl::writeBinary(out, _matrixV_RSLS);
+  impl::writeBinary(out, _matrixW_RSLS);
+  impl::writeBinary(out, _matrixCols_RSLS);
+  impl::writeBinary(out, _nbRestarts);
+  impl::writeBinary(out, _avgRank);
+  _svdJ.exportState(out);
+}
+
+// ==================================================================================
+void IQNIMVJAcceleration::importSpecializedState(
+    std::istream &in)
+{
+  PRECICE_TRACE();
+  int restartType = NO_RESTART;
+  impl::readBinary(in, restartType);
+  PRECICE_CHECK(restartType == _imvjRestartType,
+                "The IQN-IMVJ state was written with restart type {}, but the current configuration uses restart type {}. "
+                "Please use the same imvj-restart-mode when restarting the acceleration from a state checkpoint.",
+                restartType, _imvjRestartType);
+
+  Eigen::MatrixXd oldInvJacobian;
+  impl::readBinary(in, oldInvJacobian);
+  PRECICE_CHECK(oldInvJacobian.rows() == _oldInvJacobian.rows() && oldInvJacobian.cols() == _oldInvJacobian.cols(),
+                "The imported inverse Jacobian of IQN-IMVJ has dimensions {}x{}, but {}x{} were expected. "
+                "The state can only be imported for an identical partitioning of the coupling meshes.",
+                oldInvJacobian.rows(), oldInvJacobian.cols(), _oldInvJacobian.rows(), _oldInvJacobian.cols());
+  _oldInvJacobian = std::move(oldInvJacobian);
+  if (not _imvjRestart) {
+    _invJacobian = _oldInvJacobian;
+  }
+
+  impl::readBinary(in, _Wtil);
+  impl::readBinary(in, _WtilChunk);
+  impl::readBinary(in, _pseudoInverseChunk);
+  impl::readBinary(in, _lowRankCols);
+  impl::readBinary(in, _matrixV_RSLS);
+  impl::readBinary(in, _matrixW_RSLS);
+  impl::readBinary(in, _matrixCols_RSLS);
+  impl::readBinary(in, _nbRestarts);
+  impl::readBinary(in, _avgRank);
+  _svdJ.importState(in);
+}
+
 // ==================================================================================
 void IQNIMVJAcceleration::removeMatrixColumn(
     int columnIndex)
@@ -37,6 +37,7 @@ public:
   static const int RS_LS      = 2;
   static const int RS_SVD     = 3;
   static const int RS_SLIDE   = 4;
+  static const int LOW_RANK   = 5;
 
   /**
    * @brief Constructor.
@@ -75,6 +76,12 @@ public:
   virtual void specializedIterationsConverged(const DataMap &cplData);
 
 private:
+  /// @copydoc BaseQNAcceleration::exportSpecializedState
+  void exportSpecializedState(std::ostream &out) override final;
+
+  /// @copydoc BaseQNAcceleration::importSpecializedState
+  void importSpecializedState(std::istream &in) override final;
+
   /// @brief stores the approximation of the inverse Jacobian of the system at current time window.
   Eigen::MatrixXd _invJacobian;
 
@@ -84,10 +91,18 @@ private:
   /// @brief stores the sub result (W-J_prev*V) for the current iteration
   Eigen::MatrixXd _Wtil;
 
-  /// @brief stores all Wtil matrices within the current chunk of the imvj restart mode, disabled if _imvjRestart = false.
+  /** @brief stores all Wtil matrices within the current chunk of the imvj restart mode, disabled if _imvjRestart = false.
+   *
+   *  In LOW_RANK mode, there is a single entry which accumulates the Wtil matrices of all time windows column-wise.
+   *  Its capacity grows geometrically, only the first columns given by #_lowRankCols are used.
+   */
   std::vector<Eigen::MatrixXd> _WtilChunk;
 
-  /// @brief stores all pseudo inverses within the current chunk of the imvj restart mode, disabled if _imvjRestart = false.
+  /** @brief stores all pseudo inverses within the current chunk of the imvj restart mode, disabled if _imvjRestart = false.
+   *
+   *  In LOW_RANK mode, there is a single entry which accumulates the pseudo inverses of all time windows row-wise.
+   *  Its capacity grows geometrically, only the first rows given by #_lowRankCols are used.
+   */
   std::vector<Eigen::MatrixXd> _pseudoInverseChunk;
 
   /// @brief stores columns from previous  #_RSLSreusedTimeWindows time windows if RS-LS restart-mode is active
@@ -99,6 +114,9 @@ private:
   /// @brief number of cols per time window
   std::deque<int> _matrixCols_RSLS;
 
+  /// @brief number of used cols of the low-rank factors if LOW_RANK restart-mode is active
+  int _lowRankCols;
+
   /// @brief encapsulates matrix-matrix and matrix-vector multiplications for serial and parallel execution
   impl::PtrParMatrixOps _parMatrixOps;
 
@@ -113,6 +131,8 @@ private:
 
   /** @brief: Indicates the type of the imvj restart-mode:
    *  - NO_RESTART: imvj is run on normal mode which builds the Jacobian explicitly
+   *  - LOW_RANK:   imvj keeps all information as in NO_RESTART, but stores the Jacobian as product Wtil * Z of
+   *                distributed tall-skinny matrices, which is never restarted or truncated
    *  - RS-ZERO:    imvj is run in restart-mode. After M time windows all stored matrices are dropped
    *  - RS-LS:      imvj in restart-mode. After M time windows restart with LS approximation for initial Jacobian
    *  - RS-SVD:     imvj in restart mode. After M time windows, update of an truncated SVD of the Jacobian.
@@ -185,6 +205,14 @@ private:
    */
   void restartIMVJ();
 
+  /** @brief: appends the converged Wtil and Z to the compact representation J_prev = Wtil^0 * Z^0 of the LOW_RANK mode,
+   *  i.e., Wtil^0 <-- [Wtil^0, Wtil] and Z^0 <-- [Z^0; Z]. The capacity of the factors is doubled if it is exceeded.
+   */
+  void appendLowRankUpdate(const Eigen::MatrixXd &Z);
+
+  /// @brief: Returns the number of used cols of Wtil^q, which is smaller than the capacity of the LOW_RANK factors
+  int usedChunkCols(int q) const;
+
   /// @brief: Removes one iteration from V,W matrices and adapts _matrixCols.
   virtual void removeMatrixColumn(int columnIndex);
 
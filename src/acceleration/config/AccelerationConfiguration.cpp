@@ -40,6 +40,7 @@ AccelerationConfiguration::AccelerationConfiguration(
       TAG_ESTIMATEJACOBIAN("estimate-jacobian"),
       TAG_PRECONDITIONER("preconditioner"),
       TAG_IMVJRESTART("imvj-restart-mode"),
+      TAG_STATE_CHECKPOINT("state-checkpoint"),
       ATTR_NAME("name"),
       ATTR_MESH("mesh"),
       ATTR_SCALING("scaling"),
@@ -52,6 +53,9 @@ AccelerationConfiguration::AccelerationConfiguration(
       ATTR_RSLS_REUSED_TIME_WINDOWS("reused-time-windows-at-restart"),
       ATTR_RSSVD_TRUNCATIONEPS("truncation-threshold"),
       ATTR_PRECOND_NONCONST_TIME_WINDOWS("freeze-after"),
+      ATTR_INTERVAL("interval"),
+      ATTR_FILE_PREFIX("file-prefix"),
+      ATTR_RESTART("restart"),
       VALUE_CONSTANT("constant"),
       VALUE_AITKEN("aitken"),
       VALUE_IQNILS("IQN-ILS"),
@@ -68,6 +72,7 @@ AccelerationConfiguration::AccelerationConfiguration(
       VALUE_SVD_RESTART("RS-SVD"),
       VALUE_SLIDE_RESTART("RS-SLIDE"),
       VALUE_NO_RESTART("no-restart"),
+      VALUE_LOW_RANK_RESTART("low-rank"),
       _meshConfig(meshConfig),
       _acceleration(),
       _neededMeshes(),
@@ -199,6 +204,14 @@ void AccelerationConfiguration::xmlTagCallback(
     _userDefinitions.definedPreconditionerType = true;
     _config.preconditionerType                 = callingTag.getStringAttributeValue(ATTR_TYPE);
     _config.precond_nbNonConstTWindows         = callingTag.getIntAttributeValue(ATTR_PRECOND_NONCONST_TIME_WINDOWS);
+  } else if (callingTag.getName() == TAG_STATE_CHECKPOINT) {
+    _config.checkpointInterval    = callingTag.getIntAttributeValue(ATTR_INTERVAL);
+    _config.checkpointFilePrefix  = callingTag.getStringAttributeValue(ATTR_FILE_PREFIX);
+    _config.restartFromCheckpoint = callingTag.getBooleanAttributeValue(ATTR_RESTART);
+    PRECICE_CHECK(_config.checkpointInterval >= 0,
+                  "The interval of the quasi-Newton state checkpoints has to be larger than or equal to zero, "
+                  "but is {}. Use interval=\"0\" to only restart from an existing checkpoint.",
+                  _config.checkpointInterval);
   } else if (callingTag.getName() == TAG_IMVJRESTART) {
 
 #ifndef PRECICE_NO_MPI
@@ -208,6 +221,8 @@ void AccelerationConfiguration::xmlTagCallback(
                                                                              "Please remove 'always-build-jacobian' from the configuration file or do not run in restart mode.");
     if (f == VALUE_NO_RESTART) {
       _config.imvjRestartType = IQNIMVJAcceleration::NO_RESTART;
+    } else if (f == VALUE_LOW_RANK_RESTART) {
+      _config.imvjRestartType = IQNIMVJAcceleration::LOW_RANK;
     } else if (f == VALUE_ZERO_RESTART) {
       _config.imvjRestartType = IQNIMVJAcceleration::RS_ZERO;
     } else if (f == VALUE_LS_RESTART) {
@@ -239,7 +254,7 @@ void AccelerationConfiguration::xmlEndTagCallback(
     if (callingTag.getName() == VALUE_IQNILS || callingTag.getName() == VALUE_IQNIMVJ || callingTag.getName() == VALUE_AITKEN) {
 
       // if imvj restart-mode is of type RS-SVD, max number of non-const preconditioned time windows is limited by the chunksize
-      if (callingTag.getName() == VALUE_IQNIMVJ && _config.imvjRestartType > 0)
+      if (callingTag.getName() == VALUE_IQNIMVJ && _config.imvjRestartType > 0 && _config.imvjRestartType != IQNIMVJAcceleration::LOW_RANK)
         if (_config.precond_nbNonConstTWindows > _config.imvjChunkSize)
           _config.precond_nbNonConstTWindows = _config.imvjChunkSize;
       if (_config.preconditionerType == VALUE_CONSTANT_PRECONDITIONER) {
@@ -270,15 +285,16 @@ void AccelerationConfiguration::xmlEndTagCallback(
       _config.timeWindowsReused = (_userDefinitions.definedTimeWindowsReused) ? _config.timeWindowsReused : _defaultValuesIQNILS.timeWindowsReused;
       _config.filter            = (_userDefinitions.definedFilter) ? _config.filter : _defaultValuesIQNILS.filter;
       _config.singularityLimit  = (_userDefinitions.definedFilter) ? _config.singularityLimit : _defaultValuesIQNILS.singularityLimit;
-      _acceleration             = PtrAcceleration(
-          new IQNILSAcceleration(
-              _config.relaxationFactor,
-              _config.forceInitialRelaxation,
-              _config.maxIterationsUsed,
-              _config.timeWindowsReused,
-              _config.filter, _config.singularityLimit,
-              _config.dataIDs,
-              _preconditioner));
+      auto iqnils               = std::make_shared<IQNILSAcceleration>(
+          _config.relaxationFactor,
+          _config.forceInitialRelaxation,
+          _config.maxIterationsUsed,
+          _config.timeWindowsReused,
+          _config.filter, _config.singularityLimit,
+          _config.dataIDs,
+          _preconditioner);
+      iqnils->setStateCheckpointing(_config.checkpointInterval, _config.checkpointFilePrefix, _config.restartFromCheckpoint);
+      _acceleration = iqnils;
     } else if (callingTag.getName() == VALUE_IQNIMVJ) {
 #ifndef PRECICE_NO_MPI
       _config.relaxationFactor  = (_userDefinitions.definedRelaxationFactor) ? _config.relaxationFactor : _defaultValuesIQNIMVJ.relaxationFactor;
@@ -286,20 +302,21 @@ void AccelerationConfiguration::xmlEndTagCallback(
       _config.timeWindowsReused = (_userDefinitions.definedTimeWindowsReused) ? _config.timeWindowsReused : _defaultValuesIQNIMVJ.timeWindowsReused;
       _config.filter            = (_userDefinitions.definedFilter) ? _config.filter : _defaultValuesIQNILS.filter;
       _config.singularityLimit  = (_userDefinitions.definedFilter) ? _config.singularityLimit : _defaultValuesIQNILS.singularityLimit;
-      _acceleration             = PtrAcceleration(
-          new IQNIMVJAcceleration(
-              _config.relaxationFactor,
-              _config.forceInitialRelaxation,
-              _config.maxIterationsUsed,
-              _config.timeWindowsReused,
-              _config.filter, _config.singularityLimit,
-              _config.dataIDs,
-              _preconditioner,
-              _config.alwaysBuildJacobian,
-              _config.imvjRestartType,
-              _config.imvjChunkSize,
-              _config.imvjRSLS_reusedTimeWindows,
-              _config.imvjRSSVD_truncationEps));
+      auto imvj                 = std::make_shared<IQNIMVJAcceleration>(
+          _config.relaxationFactor,
+          _config.forceInitialRelaxation,
+          _config.maxIterationsUsed,
+          _config.timeWindowsReused,
+          _config.filter, _config.singularityLimit,
+          _config.dataIDs,
+          _preconditioner,
+          _config.alwaysBuildJacobian,
+          _config.imvjRestartType,
+          _config.imvjChunkSize,
+          _config.imvjRSLS_reusedTimeWindows,
+          _config.imvjRSSVD_truncationEps);
+      imvj->setStateCheckpointing(_config.checkpointInterval, _config.checkpointFilePrefix, _config.restartFromCheckpoint);
+      _acceleration = imvj;
 #else
       PRECICE_ERROR("Acceleration IQN-IMVJ only works if preCICE is compiled with MPI");
 #endif
@@ -356,6 +373,22 @@ void AccelerationConfiguration::addCommonIQNSubtags(xml::XMLTag &tag)
                             .setDocumentation("Type of the filter.");
   tagFilter.addAttribute(attrFilterName);
   tag.addSubtag(tagFilter);
+
+  XMLTag tagCheckpoint(*this, TAG_STATE_CHECKPOINT, XMLTag::OCCUR_NOT_OR_ONCE);
+  tagCheckpoint.setDocumentation("Writes the quasi-Newton state (V and W matrices, QR decomposition, preconditioner weights, "
+                                 "and the Jacobian information of IQN-IMVJ) to one binary file per rank, such that a restarted simulation "
+                                 "does not need to rebuild the least-squares system from scratch. "
+                                 "The files are only valid for the same configuration and the same partitioning of the coupling meshes.");
+  auto attrInterval = makeXMLAttribute(ATTR_INTERVAL, 0)
+                          .setDocumentation("Number of time windows between two checkpoints. 0 disables writing checkpoints.");
+  tagCheckpoint.addAttribute(attrInterval);
+  auto attrFilePrefix = makeXMLAttribute(ATTR_FILE_PREFIX, "precice-acceleration-state")
+                            .setDocumentation("Prefix of the checkpoint files, which are named `{file-prefix}-{rank}.bin`.");
+  tagCheckpoint.addAttribute(attrFilePrefix);
+  auto attrRestart = makeXMLAttribute(ATTR_RESTART, false)
+                         .setDocumentation("If set to true, the state is read from the checkpoint files before the first iteration.");
+  tagCheckpoint.addAttribute(attrRestart);
+  tag.addSubtag(tagCheckpoint);
 }
 
 void AccelerationConfiguration::addTypeSpecificSubtags(
@@ -474,6 +507,7 @@ void AccelerationConfiguration::addTypeSpecificSubtags(
     XMLTag tagIMVJRESTART(*this, TAG_IMVJRESTART, XMLTag::OCCUR_NOT_OR_ONCE);
     auto   attrRestartName = XMLAttribute<std::string>(ATTR_TYPE)
                                .setOptions({VALUE_NO_RESTART,
+                                            VALUE_LOW_RANK_RESTART,
                                             VALUE_ZERO_RESTART,
                                             VALUE_LS_RESTART,
                                             VALUE_SVD_RESTART,
@@ -483,6 +517,8 @@ void AccelerationConfiguration::addTypeSpecificSubtags(
     tagIMVJRESTART.addAttribute(attrRestartName);
     tagIMVJRESTART.setDocumentation("Type of IMVJ restart mode that is used:\n"
                                     "- `no-restart`: IMVJ runs in normal mode with explicit representation of Jacobian\n"
+                                    "- `low-rank`:   IMVJ keeps all Jacobian information as in `no-restart`, but stores the Jacobian as a product of two distributed tall-skinny matrices instead of a dense matrix. "
+                                    "The memory grows with the number of time windows and columns instead of the global number of interface unknowns. The chunk-size is ignored.\n"
                                     "- `RS-ZERO`:    IMVJ runs in restart mode. After M time windows all Jacobain information is dropped, restart with no information\n"
                                     "- `RS-LS`:      IMVJ runs in restart mode. After M time windows a IQN-LS like approximation for the initial guess of the Jacobian is computed.\n"
                                     "- `RS-SVD`:     IMVJ runs in restart mode. After M time windows a truncated SVD of the Jacobian is updated.\n"
@@ -52,6 +52,7 @@ private:
   const std::string TAG_ESTIMATEJACOBIAN;
   const std::string TAG_PRECONDITIONER;
   const std::string TAG_IMVJRESTART;
+  const std::string TAG_STATE_CHECKPOINT;
 
   const std::string ATTR_NAME;
   const std::string ATTR_MESH;
@@ -65,6 +66,9 @@ private:
   const std::string ATTR_RSLS_REUSED_TIME_WINDOWS;
   const std::string ATTR_RSSVD_TRUNCATIONEPS;
   const std::string ATTR_PRECOND_NONCONST_TIME_WINDOWS;
+  const std::string ATTR_INTERVAL;
+  const std::string ATTR_FILE_PREFIX;
+  const std::string ATTR_RESTART;
 
   const std::string VALUE_CONSTANT;
   const std::string VALUE_AITKEN;
@@ -82,6 +86,7 @@ private:
   const std::string VALUE_SVD_RESTART;
   const std::string VALUE_SLIDE_RESTART;
   const std::string VALUE_NO_RESTART;
+  const std::string VALUE_LOW_RANK_RESTART;
 
   const mesh::PtrMeshConfiguration _meshConfig;
 
@@ -114,6 +119,9 @@ private:
     bool                  estimateJacobian           = false;
     bool                  alwaysBuildJacobian        = false;
     std::string           preconditionerType;
+    int                   checkpointInterval         = 0;
+    std::string           checkpointFilePrefix;
+    bool                  restartFromCheckpoint      = false;
 
     std::vector<double> scalingFactorsInOrder() const;
   } _config;
@@ -0,0 +1,163 @@
+#include "acceleration/impl/BinaryState.hpp"
+#include <cstdint>
+#include <istream>
+#include <ostream>
+
+#include "logging/LogMacros.hpp"
+#include "logging/Logger.hpp"
+
+namespace precice::acceleration::impl {
+
+namespace {
+
+logging::Logger _log("acceleration::BinaryState");
+
+template <typename T>
+void writeRaw(std::ostream &out, const T *data, std::int64_t count)
+{
+  out.write(reinterpret_cast<const char *>(data), count * static_cast<std::int64_t>(sizeof(T)));
+}
+
+template <typename T>
+void readRaw(std::istream &in, T *data, std::int64_t count)
+{
+  in.read(reinterpret_cast<char *>(data), count * static_cast<std::int64_t>(sizeof(T)));
+  PRECICE_CHECK(in.good(), "The acceleration state could not be read as the stream ended prematurely. "
+                           "The state file is either truncated or was written by a different configuration.");
+}
+
+void writeSize(std::ostream &out, std::int64_t size)
+{
+  writeRaw(out, &size, 1);
+}
+
+std::int64_t readSize(std::istream &in)
+{
+  std::int64_t size = 0;
+  readRaw(in, &size, 1);
+  PRECICE_CHECK(size >= 0, "The acceleration state contains an invalid size of {}. The state file is corrupted.", size);
+  return size;
+}
+
+} // namespace
+
+void writeBinary(std::ostream &out, int value)
+{
+  writeRaw(out, &value, 1);
+}
+
+void writeBinary(std::ostream &out, bool value)
+{
+  const char raw = value ? 1 : 0;
+  writeRaw(out, &raw, 1);
+}
+
+void writeBinary(std::ostream &out, double value)
+{
+  writeRaw(out, &value, 1);
+}
+
+void writeBinary(std::ostream &out, const std::string &value)
+{
+  writeSize(out, value.size());
+  writeRaw(out, value.data(), value.size());
+}
+
+void writeBinary(std::ostream &out, const Eigen::VectorXd &vector)
+{
+  writeSize(out, vector.size());
+  writeRaw(out, vector.data(), vector.size());
+}
+
+void writeBinary(std::ostream &out, const Eigen::MatrixXd &matrix)
+{
+  writeSize(out, matrix.rows());
+  writeSize(out, matrix.cols());
+  writeRaw(out, matrix.data(), matrix.size());
+}
+
+void writeBinary(std::ostream &out, const std::vector<double> &values)
+{
+  writeSize(out, values.size());
+  writeRaw(out, values.data(), values.size());
+}
+
+void writeBinary(std::ostream &out, const std::deque<int> &values)
+{
+  writeSize(out, values.size());
+  for (int value : values) {
+    writeRaw(out, &value, 1);
+  }
+}
+
+void writeBinary(std::ostream &out, const std::vector<Eigen::MatrixXd> &matrices)
+{
+  writeSize(out, matrices.size());
+  for (const auto &matrix : matrices) {
+    writeBinary(out, matrix);
+  }
+}
+
+void readBinary(std::istream &in, int &value)
+{
+  readRaw(in, &value, 1);
+}
+
+void readBinary(std::istream &in, bool &value)
+{
+  char raw = 0;
+  readRaw(in, &raw, 1);
+  value = (raw != 0);
+}
+
+void readBinary(std::istream &in, double &value)
+{
+  readRaw(in, &value, 1);
+}
+
+void readBinary(std::istream &in, std::string &value)
+{
+  value.resize(readSize(in));
+  readRaw(in, value.data(), value.size());
+}
+
+void readBinary(std::istream &in, Eigen::VectorXd &vector)
+{
+  vector.resize(readSize(in));
+  readRaw(in, vector.data(), vector.size());
+}
+
+void readBinary(std::istream &in, Eigen::MatrixXd &matrix)
+{
+  const auto rows = readSize(in);
+  const auto cols = readSize(in);
+  matrix.resize(rows, cols);
+  readRaw(in, matrix.data(), matrix.size());
+}
+
+void readBinary(std::istream &in, std::vector<double> &values)
+{
+  values.resize(readSize(in));
+  readRaw(in, values.data(), values.size());
+}
+
+void readBinary(std::istream &in, std::deque<int> &values)
+{
+  const auto size = readSize(in);
+  values.clear();
+  for (std::int64_t i = 0; i < size; ++i) {
+    int value = 0;
+    readRaw(in, &value, 1);
+    values.push_back(value);
+  }
+}
+
+void readBinary(std::istream &in, std::vector<Eigen::MatrixXd> &matrices)
+{
+  matrices.resize(readSize(in));
+  for (auto &matrix : matrices) {
+    readBinary(in, matrix);
+  }
+}
+
+} // namespace precice::acceleration::impl
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <Eigen/Core>
+#include <deque>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+namespace precice {
+namespace acceleration {
+namespace impl {
+
+/**
+ * @brief Helpers to (de)serialize the state of acceleration schemes in a compact binary format.
+ *
+ * Values are stored in native byte order, sizes are stored as 64 bit integers.
+ * The files are meant to be written and read on the same machine by the same rank,
+ * they are no portable exchange format.
+ *
+ * All read functions abort with an error if the stream ends prematurely.
+ */
+
+void writeBinary(std::ostream &out, int value);
+void writeBinary(std::ostream &out, bool value);
+void writeBinary(std::ostream &out, double value);
+void writeBinary(std::ostream &out, const std::string &value);
+void writeBinary(std::ostream &out, const Eigen::VectorXd &vector);
+void writeBinary(std::ostream &out, const Eigen::MatrixXd &matrix);
+void writeBinary(std::ostream &out, const std::vector<double> &values);
+void writeBinary(std::ostream &out, const std::deque<int> &values);
+void writeBinary(std::ostream &out, const std::vector<Eigen::MatrixXd> &matrices);
+
+void readBinary(std::istream &in, int &value);
+void readBinary(std::istream &in, bool &value);
+void readBinary(std::istream &in, double &value);
+void readBinary(std::istream &in, std::string &value);
+void readBinary(std::istream &in, Eigen::VectorXd &vector);
+void readBinary(std::istream &in, Eigen::MatrixXd &matrix);
+void readBinary(std::istream &in, std::vector<double> &values);
+void readBinary(std::istream &in, std::deque<int> &values);
+void readBinary(std::istream &in, std::vector<Eigen::MatrixXd> &matrices);
+
+} // namespace impl
+} // namespace acceleration
+} // namespace precice
@@ -1,9 +1,12 @@
 #pragma once
 
 #include <Eigen/Core>
+#include <iosfwd>
 #include <numeric>
+#include <utility>
 #include <vector>
 
+#include "acceleration/impl/BinaryState.hpp"
 #include "cplscheme/SharedPointer.hpp"
 #include "logging/LogMacros.hpp"
 #include "logging/Logger.hpp"
@@ -210,6 +213,33 @@ public:
     return _frozen;
   }
 
+  /// Writes the weights and the freezing state to a binary stream
+  void exportState(std::ostream &out) const
+  {
+    writeBinary(out, _weights);
+    writeBinary(out, _invWeights);
+    writeBinary(out, _nbNonConstTimeWindows);
+    writeBinary(out, _frozen);
+  }
+
+  /// Restores the weights and the freezing state written by exportState()
+  void importState(std::istream &in)
+  {
+    PRECICE_TRACE();
+    std::vector<double> weights;
+    std::vector<double> invWeights;
+    readBinary(in, weights);
+    readBinary(in, invWeights);
+    PRECICE_CHECK(weights.size() == _weights.size() && invWeights.size() == _invWeights.size(),
+                  "The preconditioner state to import has {} weights, but the current coupling data has {} entries. "
+                  "The state can only be imported for an identical partitioning of the coupling meshes.",
+                  weights.size(), _weights.size());
+    _weights    = std::move(weights);
+    _invWeights = std::move(invWeights);
+    readBinary(in, _nbNonConstTimeWindows);
+    readBinary(in, _frozen);
+  }
+
 protected:
   /// Weights used to scale the matrix V and the residual
   std::vector<double> _weights;
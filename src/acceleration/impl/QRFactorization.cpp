@@ -9,6 +9,7 @@
 #include <vector>
 
 #include "acceleration/Acceleration.hpp"
+#include "acceleration/impl/BinaryState.hpp"
 #include "acceleration/impl/QRFactorization.hpp"
 #include "com/Communication.hpp"
 #include "com/SharedPointer.hpp"
@@ -777,4 +778,26 @@ void QRFactorization::setFilter(int filter)
   _filter = filter;
 }
 
+void QRFactorization::exportState(std::ostream &out) const
+{
+  writeBinary(out, _Q);
+  writeBinary(out, _R);
+  writeBinary(out, _rows);
+  writeBinary(out, _cols);
+  writeBinary(out, _globalRows);
+}
+
+void QRFactorization::importState(std::istream &in)
+{
+  PRECICE_TRACE();
+  readBinary(in, _Q);
+  readBinary(in, _R);
+  readBinary(in, _rows);
+  readBinary(in, _cols);
+  readBinary(in, _globalRows);
+  PRECICE_CHECK(_Q.rows() == _rows && _Q.cols() == _cols && _R.rows() == _cols && _R.cols() == _cols,
+                "The imported QR factorization is inconsistent: Q is {}x{} and R is {}x{}, but {} rows and {} columns were expected.",
+                _Q.rows(), _Q.cols(), _R.rows(), _R.cols(), _rows, _cols);
+}
+
 } // namespace precice::acceleration::impl
@@ -158,6 +158,12 @@ public:
   // @brief sets the filtering technique to maintain good conditioning of the least squares system
   void setFilter(int filter);
 
+  // @brief writes the factorization Q, R and its dimensions to a binary stream
+  void exportState(std::ostream &out) const;
+
+  // @brief restores a factorization written by exportState(), keeps the filter parameters
+  void importState(std::istream &in);
+
 private:
   struct givensRot {
     int    i, j;
@@ -2,9 +2,12 @@
 
 #include "acceleration/impl/SVDFactorization.hpp"
 #include <Eigen/Core>
+#include <istream>
 #include <limits>
+#include <ostream>
 #include <utility>
 
+#include "acceleration/impl/BinaryState.hpp"
 #include "utils/IntraComm.hpp"
 
 namespace precice::acceleration::impl {
@@ -269,6 +272,32 @@ bool SVDFactorization::isSVDinitialized()
   return _initialSVD;
 }
 
+void SVDFactorization::exportState(std::ostream &out) const
+{
+  writeBinary(out, _psi);
+  writeBinary(out, _phi);
+  writeBinary(out, _sigma);
+  writeBinary(out, _rowsA);
+  writeBinary(out, _rowsB);
+  writeBinary(out, _cols);
+  writeBinary(out, _initialSVD);
+}
+
+void SVDFactorization::importState(std::istream &in)
+{
+  PRECICE_TRACE();
+  readBinary(in, _psi);
+  readBinary(in, _phi);
+  readBinary(in, _sigma);
+  readBinary(in, _rowsA);
+  readBinary(in, _rowsB);
+  readBinary(in, _cols);
+  readBinary(in, _initialSVD);
+  PRECICE_CHECK(_psi.cols() == _cols && _phi.cols() == _cols && _sigma.size() == _cols,
+                "The imported truncated SVD is inconsistent: it has {} columns, but Psi has {}, Phi has {} and Sigma has {} columns.",
+                _cols, _psi.cols(), _phi.cols(), _sigma.size());
+}
+
 void SVDFactorization::setThreshold(double eps)
 {
   _truncationEps = eps;
@@ -10,6 +10,7 @@
 
 #include <Eigen/Core>
 #include <Eigen/Dense>
+#include <iosfwd>
 #include <string>
 
 #include "acceleration/impl/ParallelMatrixOperations.hpp"
@@ -229,6 +230,12 @@ public:
 
   bool isSVDinitialized();
 
+  /// @brief: writes the truncated factorization and its dimensions to a binary stream
+  void exportState(std::ostream &out) const;
+
+  /// @brief: restores a truncated factorization written by exportState()
+  void importState(std::istream &in);
+
   /// Optional file-stream for logging output
   void setfstream(std::fstream *stream);
 
@@ -1,5 +1,8 @@
 #include <Eigen/Core>
 #include <algorithm>
+#include <cstdio>
+#include <functional>
+#include <sstream>
 #include "acceleration/Acceleration.hpp"
 #include "acceleration/AitkenAcceleration.hpp"
 #include "acceleration/BaseQNAcceleration.hpp"
@@ -10,6 +13,7 @@
 #include "acceleration/config/AccelerationConfiguration.hpp"
 #include "acceleration/impl/ConstantPreconditioner.hpp"
 #include "acceleration/impl/ResidualPreconditioner.hpp"
+#include "acceleration/impl/ResidualSumPreconditioner.hpp"
 #include "acceleration/impl/SharedPointer.hpp"
 #include "acceleration/test/helper.hpp"
 #include "cplscheme/CouplingData.hpp"
@@ -778,6 +782,176 @@ BOOST_AUTO_TEST_CASE(testConstantUnderrelaxationWithGradientWithoutSubsteps)
   BOOST_TEST(data.at(0)->gradients()(1, 2) == 3.4);
 }
 
+/// Emulates a nonlinear solver, which maps the accelerated input to a new output in every iteration
+void solveStateTestData(AccelerationSerialTestsFixture::DataMap &data, int timeWindow)
+{
+  for (auto &pair : data) {
+    pair.second->setSampleAtTime(1.0, pair.second->sample());
+    pair.second->storeIteration();
+    Eigen::VectorXd &values = pair.second->values();
+    values                  = 0.5 * values.array().cos().matrix() + Eigen::VectorXd::LinSpaced(values.size(), 1.0, 2.0) * (timeWindow + pair.first);
+  }
+}
+
+/// Runs a time window with three accelerated iterations
+void runStateTestTimeWindow(Acceleration &acceleration, AccelerationSerialTestsFixture::DataMap &data, int timeWindow)
+{
+  for (int iteration = 0; iteration < 3; ++iteration) {
+    solveStateTestData(data, timeWindow);
+    acceleration.performAcceleration(data);
+  }
+  solveStateTestData(data, timeWindow);
+  acceleration.iterationsConverged(data);
+}
+
+void testStateCheckpointing(const std::function<std::shared_ptr<BaseQNAcceleration>()> &makeAcceleration, const std::string &filePrefix)
+{
+  using DataMap = AccelerationSerialTestsFixture::DataMap;
+  mesh::PtrMesh dummyMesh(new mesh::Mesh("DummyMesh", 3, testing::nextMeshID()));
+
+  auto makeData = [&dummyMesh]() {
+    mesh::PtrData displacements(new mesh::Data("dvalues", -1, 1));
+    mesh::PtrData forces(new mesh::Data("fvalues", -1, 1));
+    displacements->values() = Eigen::VectorXd::Constant(10, 1.0);
+    displacements->setSampleAtTime(0, displacements->sample());
+    forces->values() = Eigen::VectorXd::Constant(10, 0.2);
+    forces->setSampleAtTime(0, forces->sample());
+
+    DataMap data;
+    data.emplace(0, makeCouplingData(displacements, dummyMesh, false));
+    data.emplace(1, makeCouplingData(forces, dummyMesh, false));
+    for (auto &pair : data) {
+      pair.second->storeIteration();
+    }
+    return data;
+  };
+
+  // reference run which writes a checkpoint after the second time window
+  auto    reference     = makeAcceleration();
+  DataMap referenceData = makeData();
+  reference->setStateCheckpointing(2, filePrefix, false);
+  reference->initialize(referenceData);
+  runStateTestTimeWindow(*reference, referenceData, 1);
+  runStateTestTimeWindow(*reference, referenceData, 2);
+  const Eigen::VectorXd checkpointDisplacements = referenceData.at(0)->values();
+  const Eigen::VectorXd checkpointForces        = referenceData.at(1)->values();
+  runStateTestTimeWindow(*reference, referenceData, 3);
+
+  // restarted run which continues from the checkpoint
+  auto    restarted     = makeAcceleration();
+  DataMap restartedData = makeData();
+  restarted->setStateCheckpointing(0, filePrefix, true);
+  restarted->initialize(restartedData);
+  restartedData.at(0)->values() = checkpointDisplacements;
+  restartedData.at(1)->values() = checkpointForces;
+  runStateTestTimeWindow(*restarted, restartedData, 3);
+
+  // cold run without the checkpoint
+  auto    cold     = makeAcceleration();
+  DataMap coldData = makeData();
+  cold->initialize(coldData);
+  coldData.at(0)->values() = checkpointDisplacements;
+  coldData.at(1)->values() = checkpointForces;
+  runStateTestTimeWindow(*cold, coldData, 3);
+
+  BOOST_TEST(restarted->getLSSystemCols() == reference->getLSSystemCols());
+  BOOST_TEST(testing::equals(restartedData.at(0)->values(), referenceData.at(0)->values()));
+  BOOST_TEST(testing::equals(restartedData.at(1)->values(), referenceData.at(1)->values()));
+  BOOST_TEST(not testing::equals(coldData.at(0)->values(), referenceData.at(0)->values()));
+
+  // exporting an imported state reproduces it exactly
+  std::stringstream state;
+  reference->exportState(state);
+  auto    roundTrip     = makeAcceleration();
+  DataMap roundTripData = makeData();
+  roundTrip->initialize(roundTripData);
+  roundTrip->importState(state);
+  std::stringstream reexported;
+  roundTrip->exportState(reexported);
+  BOOST_TEST(reexported.str() == state.str());
+
+  std::remove((filePrefix + "-0.bin").c_str());
+}
+
+BOOST_AUTO_TEST_CASE(testIQNILSStateCheckpointing)
+{
+  PRECICE_TEST(1_rank);
+  testStateCheckpointing([]() {
+    std::vector<double> factors(2, 1.0);
+    auto                prec = std::make_shared<impl::ConstantPreconditioner>(factors);
+    return std::make_shared<IQNILSAcceleration>(0.1, false, 50, 2, Acceleration::QR1FILTER, 1e-10, std::vector<int>{0, 1}, prec);
+  },
+                         "IQNILSStateCheckpointing");
+}
+
+BOOST_AUTO_TEST_CASE(testIQNIMVJStateCheckpointing)
+{
+  PRECICE_TEST(1_rank);
+  testStateCheckpointing([]() {
+    auto prec = std::make_shared<impl::ResidualSumPreconditioner>(-1);
+    return std::make_shared<IQNIMVJAcceleration>(0.1, false, 20, 0, Acceleration::QR2FILTER, 1e-2, std::vector<int>{0, 1}, prec,
+                                                 false, IQNIMVJAcceleration::NO_RESTART, 0, 0, 0.0);
+  },
+                         "IQNIMVJStateCheckpointing");
+}
+
+BOOST_AUTO_TEST_CASE(testIQNIMVJLowRank)
+{
+  PRECICE_TEST(1_rank);
+  using DataMap = AccelerationSerialTestsFixture::DataMap;
+  mesh::PtrMesh dummyMesh(new mesh::Mesh("DummyMesh", 3, testing::nextMeshID()));
+
+  auto makeData = [&dummyMesh]() {
+    mesh::PtrData displacements(new mesh::Data("dvalues", -1, 1));
+    mesh::PtrData forces(new mesh::Data("fvalues", -1, 1));
+    displacements->values() = Eigen::VectorXd::Constant(10, 1.0);
+    displacements->setSampleAtTime(0, displacements->sample());
+    forces->values() = Eigen::VectorXd::Constant(10, 0.2);
+    forces->setSampleAtTime(0, forces->sample());
+
+    DataMap data;
+    data.emplace(0, makeCouplingData(displacements, dummyMesh, false));
+    data.emplace(1, makeCouplingData(forces, dummyMesh, false));
+    for (auto &pair : data) {
+      pair.second->storeIteration();
+    }
+    return data;
+  };
+
+  auto makeAcceleration = [](int restartType, int chunkSize) {
+    auto prec = std::make_shared<impl::ResidualSumPreconditioner>(-1);
+    return std::make_shared<IQNIMVJAcceleration>(0.1, false, 20, 0, Acceleration::QR2FILTER, 1e-2, std::vector<int>{0, 1}, prec,
+                                                 false, restartType, chunkSize, 0, 0.0);
+  };
+
+  // the low-rank representation keeps all time windows and is, thus, equivalent to the dense one.
+  // The chunk-size is ignored, and the time windows exceed the initial capacity of the factors.
+  auto    dense       = makeAcceleration(IQNIMVJAcceleration::NO_RESTART, 0);
+  auto    lowRank     = makeAcceleration(IQNIMVJAcceleration::LOW_RANK, 2);
+  DataMap denseData   = makeData();
+  DataMap lowRankData = makeData();
+  dense->initialize(denseData);
+  lowRank->initialize(lowRankData);
+
+  for (int timeWindow = 1; timeWindow <= 10; ++timeWindow) {
+    runStateTestTimeWindow(*dense, denseData, timeWindow);
+    runStateTestTimeWindow(*lowRank, lowRankData, timeWindow);
+    BOOST_TEST(testing::equals(lowRankData.at(0)->values(), denseData.at(0)->values(), 1e-10));
+    BOOST_TEST(testing::equals(lowRankData.at(1)->values(), denseData.at(1)->values(), 1e-10));
+  }
+
+  // the low-rank state survives an export/import cycle
+  std::stringstream state;
+  lowRank->exportState(state);
+  auto    roundTrip     = makeAcceleration(IQNIMVJAcceleration::LOW_RANK, 2);
+  DataMap roundTripData = makeData();
+  roundTrip->initialize(roundTripData);
+  roundTrip->importState(state);
+  std::stringstream reexported;
+  roundTrip->exportState(reexported);
+  BOOST_TEST(reexported.str() == state.str());
+}
+
 #endif // not PRECICE_NO_MPI
 
 BOOST_AUTO_TEST_SUITE_END()
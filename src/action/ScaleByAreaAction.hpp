@@ -1,5 +1,7 @@
 #pragma once
 
+#include <Eigen/Core>
+#include <cstddef>
 #include <string>
 #include "Action.hpp"
 #include "logging/Logger.hpp"
@@ -39,6 +41,17 @@ private:
   mesh::PtrData _targetData;
 
   Scaling _scaling;
+
+  /// Area associated to each vertex, cached until the mesh changes
+  Eigen::VectorXd _areas;
+
+  /// Revision of the mesh the areas were computed for
+  std::size_t _areasRevision = 0;
+
+  bool _hasAreas = false;
+
+  /// Returns the area of the edges or triangles associated to each vertex
+  const Eigen::VectorXd &vertexAreas();
 };
 
 } // namespace precice::action
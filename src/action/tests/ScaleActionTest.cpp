@@ -108,6 +108,46 @@ BOOST_AUTO_TEST_CASE(DivideByArea3D)
   BOOST_TEST(values(4) == 6.0);
 }
 
+BOOST_AUTO_TEST_CASE(MultiplyByAreaVectorAfterMeshChange)
+{
+  PRECICE_TEST(1_rank);
+  using namespace mesh;
+  PtrMesh mesh(new Mesh("Mesh", 2, testing::nextMeshID()));
+  PtrData data   = mesh->createData("test-data", 2, 0_dataID);
+  int     dataID = data->getID();
+  {
+    Vertex &v0 = mesh->createVertex(Eigen::Vector2d(0.0, 0.0));
+    Vertex &v1 = mesh->createVertex(Eigen::Vector2d(1.0, 0.0));
+    Vertex &v2 = mesh->createVertex(Eigen::Vector2d(1.0, 1.0));
+    mesh->createEdge(v0, v1);
+    mesh->createEdge(v1, v2);
+  }
+  mesh->allocateDataValues();
+  data->setSampleAtTime(1, time::Sample{2, Eigen::VectorXd::Constant(6, 2.0)});
+
+  action::ScaleByAreaAction scale(
+      action::ScaleByAreaAction::WRITE_MAPPING_POST, dataID, mesh,
+      action::ScaleByAreaAction::SCALING_MULTIPLY_BY_AREA);
+
+  scale.performAction();
+  const auto &values = data->values();
+  BOOST_TEST(testing::equals(values, Eigen::VectorXd{{1.0, 1.0, 2.0, 2.0, 1.0, 1.0}}));
+
+  // The areas of the changed mesh are used
+  mesh->clear();
+  {
+    Vertex &v0 = mesh->createVertex(Eigen::Vector2d(0.0, 0.0));
+    Vertex &v1 = mesh->createVertex(Eigen::Vector2d(4.0, 0.0));
+    mesh->createEdge(v0, v1);
+  }
+  mesh->allocateDataValues();
+  data->timeStepsStorage().clear();
+  data->setSampleAtTime(1, time::Sample{2, Eigen::VectorXd::Constant(4, 2.0)});
+
+  scale.performAction();
+  BOOST_TEST(testing::equals(data->values(), Eigen::VectorXd::Constant(4, 4.0)));
+}
+
 BOOST_AUTO_TEST_CASE(Configuration)
 {
   PRECICE_TEST(1_rank);
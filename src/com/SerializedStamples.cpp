@@ -1,18 +1,26 @@
 #include "com/SerializedStamples.hpp"
+#include <numeric>
 #include "cplscheme/CouplingData.hpp"
 #include "math/differences.hpp"
 
 namespace precice::com::serialize {
 
 SerializedStamples SerializedStamples::serialize(const cplscheme::PtrCouplingData data)
+{
+  std::vector<int> stampleIds(data->timeStepsStorage().nTimes());
+  std::iota(stampleIds.begin(), stampleIds.end(), 0);
+  return serialize(data, stampleIds);
+}
+
+SerializedStamples SerializedStamples::serialize(const cplscheme::PtrCouplingData data, const std::vector<int> &stampleIds)
 {
   SerializedStamples result;
 
-  result._timeSteps = data->timeStepsStorage().nTimes(); // @todo use all available time steps for subcycling
+  result._timeSteps = stampleIds.size();
   result.allocate(data);
-  result.serializeValues(data);
+  result.serializeValues(data, stampleIds);
   if (data->hasGradient()) {
-    result.serializeGradients(data);
+    result.serializeGradients(data, stampleIds);
   }
   return result;
 }
@@ -44,12 +52,12 @@ void SerializedStamples::allocate(const cplscheme::PtrCouplingData data)
   }
 }
 
-void SerializedStamples::serializeValues(const cplscheme::PtrCouplingData data)
+void SerializedStamples::serializeValues(const cplscheme::PtrCouplingData data, const std::vector<int> &stampleIds)
 {
   const int nValues = data->sample().values.size();
   int       timeId  = 0;
-  for (const auto &stample : data->stamples()) {
-    const Eigen::VectorXd &slice = stample.sample.values;
+  for (int stampleId : stampleIds) {
+    const Eigen::VectorXd &slice = data->stamples()[stampleId].sample.values;
     for (int valueId = 0; valueId < nValues; valueId++) {
       _values(valueId * _timeSteps + timeId) = slice(valueId);
     }
@@ -57,12 +65,13 @@ void SerializedStamples::serializeValues(const cplscheme::PtrCouplingData data)
   }
 }
 
-void SerializedStamples::serializeGradients(const cplscheme::PtrCouplingData data)
+void SerializedStamples::serializeGradients(const cplscheme::PtrCouplingData data, const std::vector<int> &stampleIds)
 {
   const int nValues = data->sample().gradients.size();
   int       timeId  = 0;
-  for (const auto &stample : data->stamples()) {
-    const Eigen::VectorXd &slice = Eigen::VectorXd::Map(stample.sample.gradients.data(), stample.sample.gradients.rows() * stample.sample.gradients.cols());
+  for (int stampleId : stampleIds) {
+    const auto &           gradients = data->stamples()[stampleId].sample.gradients;
+    const Eigen::VectorXd &slice     = Eigen::VectorXd::Map(gradients.data(), gradients.rows() * gradients.cols());
     PRECICE_ASSERT(nValues == slice.size());
     for (int valueId = 0; valueId < slice.size(); valueId++) {
       _gradients(valueId * _timeSteps + timeId) = slice(valueId);
@@ -77,27 +86,25 @@ void SerializedStamples::deserialize(const Eigen::VectorXd timeStamps, cplscheme
 
   data->timeStepsStorage().clear(); // @todo needs optimization. Don't need to communicate and serialize / deserialize data at beginning of window, because it is already there.
 
-  const auto dataDims = data->getDimensions();
+  const auto         dataDims     = data->getDimensions();
+  const Eigen::Index gradientRows = data->hasGradient() ? data->sample().gradients.rows() : 0;
+  const Eigen::Index gradientCols = data->hasGradient() ? data->sample().gradients.cols() : 0;
+  auto &             storage      = data->timeStepsStorage();
 
   for (int timeId = 0; timeId < timeStamps.size(); timeId++) {
     const double time = timeStamps(timeId);
 
-    Eigen::VectorXd slice(data->getSize());
-    for (int valueId = 0; valueId < slice.size(); valueId++) {
-      slice(valueId) = _values(valueId * timeStamps.size() + timeId);
-    }
-
-    if (!data->hasGradient()) {
-      data->setSampleAtTime(time, time::Sample{dataDims, std::move(slice)});
-      continue;
+    // Reuses the buffers of the samples cleared above
+    auto sample = storage.acquireSample(dataDims, data->getSize(), gradientRows, gradientCols);
+    for (int valueId = 0; valueId < sample.values.size(); valueId++) {
+      sample.values(valueId) = _values(valueId * timeStamps.size() + timeId);
     }
 
-    Eigen::MatrixXd gradientSlice(data->sample().gradients.rows(), data->sample().gradients.cols());
-    auto            gradientView = Eigen::VectorXd::Map(gradientSlice.data(), gradientSlice.rows() * gradientSlice.cols());
+    auto gradientView = Eigen::VectorXd::Map(sample.gradients.data(), sample.gradients.size());
     for (int gradientId = 0; gradientId < gradientView.size(); gradientId++) {
       gradientView(gradientId) = _gradients(gradientId * timeStamps.size() + timeId);
     }
-    data->setSampleAtTime(time, time::Sample{dataDims, std::move(slice), std::move(gradientSlice)});
+    data->setSampleAtTime(time, std::move(sample));
   }
 }
 
@@ -21,6 +21,15 @@ public:
    */
   static SerializedStamples serialize(const cplscheme::PtrCouplingData data);
 
+  /**
+   * @brief Serializes the selected stamples of a given CouplingData into SerializedStamples
+   *
+   * @param data pointer to CouplingData to be serialized
+   * @param stampleIds ascending indices of the stamples to serialize
+   * @return SerializedStamples contains the serialized data
+   */
+  static SerializedStamples serialize(const cplscheme::PtrCouplingData data, const std::vector<int> &stampleIds);
+
   /**
    * @brief Create SerializedStamples with allocated buffers according to size of CouplingData
    *
@@ -83,15 +92,17 @@ private:
    * @brief Serialize values from timeStepsStorage of data into _values
    *
    * @param data the data that is serialized
+   * @param stampleIds indices of the serialized stamples
    */
-  void serializeValues(const cplscheme::PtrCouplingData data);
+  void serializeValues(const cplscheme::PtrCouplingData data, const std::vector<int> &stampleIds);
 
   /**
    * @brief Serialize gradients from timeStepsStorage of data into _gradients
    *
    * @param data the data that is serialized
+   * @param stampleIds indices of the serialized stamples
    */
-  void serializeGradients(const cplscheme::PtrCouplingData data);
+  void serializeGradients(const cplscheme::PtrCouplingData data, const std::vector<int> &stampleIds);
 
   /**
      * @brief Deserialize _values and (if required by data) _gradients into  timeStepsStorage of data. Use provided timeStamps.
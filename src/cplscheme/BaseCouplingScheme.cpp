@@ -6,6 +6,7 @@
 #include <functional>
 #include <iterator>
 #include <limits>
+#include <numeric>
 #include <sstream>
 #include <utility>
 
@@ -16,6 +17,7 @@
 #include "cplscheme/CouplingData.hpp"
 #include "cplscheme/CouplingScheme.hpp"
 #include "cplscheme/impl/SharedPointer.hpp"
+#include "cplscheme/impl/SubstepReduction.hpp"
 #include "impl/ConvergenceMeasure.hpp"
 #include "io/TXTTableWriter.hpp"
 #include "logging/LogMacros.hpp"
@@ -119,6 +121,11 @@ void BaseCouplingScheme::sendData(const m2n::PtrM2N &m2n, const DataMap &sendDat
   PRECICE_ASSERT(m2n->isConnected());
 
   for (const auto &data : sendData | boost::adaptors::map_values) {
+    // Previously sent data is still in transit, which allows to overlap the preparation of this data
+    if (_sendDataHook) {
+      _sendDataHook(data->getDataID());
+    }
+
     const auto &stamples = data->stamples();
     PRECICE_ASSERT(!stamples.empty());
 
@@ -126,11 +133,22 @@ void BaseCouplingScheme::sendData(const m2n::PtrM2N &m2n, const DataMap &sendDat
     PRECICE_ASSERT(nTimeSteps > 0);
 
     if (data->exchangeSubsteps()) {
-      const Eigen::VectorXd timesAscending = data->timeStepsStorage().getTimes();
-      sendNumberOfTimeSteps(m2n, nTimeSteps);
+      Eigen::VectorXd  timesAscending = data->timeStepsStorage().getTimes();
+      std::vector<int> stampleIds(nTimeSteps);
+      std::iota(stampleIds.begin(), stampleIds.end(), 0);
+
+      // Gradients are not interpolated in time, hence, they require all substeps
+      if (data->substepsTolerance() > 0.0 && !data->hasGradient()) {
+        const auto [times, values] = data->timeStepsStorage().getTimesAndValues();
+        stampleIds                 = impl::reduceSubsteps(times, values, data->timeStepsStorage().getInterpolationDegree(), data->substepsTolerance());
+        timesAscending             = times(stampleIds);
+        PRECICE_DEBUG("Sending {} of {} substeps of data \"{}\"", stampleIds.size(), nTimeSteps, data->getDataName());
+      }
+
+      sendNumberOfTimeSteps(m2n, stampleIds.size());
       sendTimes(m2n, timesAscending);
 
-      const auto serialized = com::serialize::SerializedStamples::serialize(data);
+      const auto serialized = com::serialize::SerializedStamples::serialize(data, stampleIds);
 
       // Data is actually only send if size>0, which is checked in the derived classes implementation
       m2n->send(serialized.values(), data->getMeshID(), data->getDimensions() * serialized.nTimeSteps());
@@ -921,4 +939,9 @@ std::string BaseCouplingScheme::localParticipant() const
   return _localParticipant;
 }
 
+void BaseCouplingScheme::setSendDataHook(SendDataHook hook)
+{
+  _sendDataHook = std::move(hook);
+}
+
 } // namespace precice::cplscheme
@@ -397,6 +397,9 @@ protected:
   /// @copydoc cplscheme::CouplingScheme::implicitDataToReceive()
   ImplicitData implicitDataToReceive() const override;
 
+  /// @copydoc cplscheme::CouplingScheme::setSendDataHook()
+  void setSendDataHook(SendDataHook hook) override final;
+
   /// @copydoc cplscheme::CouplingScheme::localParticipant()
   std::string localParticipant() const override final;
 
@@ -458,6 +461,9 @@ private:
 
   std::set<Action> _fulfilledActions;
 
+  /// Invoked for every send data right before it is sent, see setSendDataHook()
+  SendDataHook _sendDataHook;
+
   /// True if implicit scheme converged
   bool _hasConverged = false;
 
@@ -51,10 +51,12 @@ void BiCouplingScheme::addDataToSend(
     const mesh::PtrData &data,
     mesh::PtrMesh        mesh,
     bool                 requiresInitialization,
-    bool                 exchangeSubsteps)
+    bool                 exchangeSubsteps,
+    double               substepsTolerance)
 {
   PRECICE_TRACE();
   PtrCouplingData ptrCplData = addCouplingData(data, std::move(mesh), requiresInitialization, exchangeSubsteps, CouplingData::Direction::Send);
+  ptrCplData->setSubstepsTolerance(substepsTolerance);
 
   if (!utils::contained(data->getID(), _sendData)) {
     PRECICE_ASSERT(_sendData.count(data->getID()) == 0, "Key already exists!");
@@ -45,7 +45,8 @@ public:
       const mesh::PtrData &data,
       mesh::PtrMesh        mesh,
       bool                 requiresInitialization,
-      bool                 exchangeSubsteps);
+      bool                 exchangeSubsteps,
+      double               substepsTolerance = 0.0);
 
   /// Adds data to be received on data exchange.
   void addDataToReceive(
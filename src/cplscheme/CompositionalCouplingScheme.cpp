@@ -510,4 +510,11 @@ ImplicitData CompositionalCouplingScheme::implicitDataToReceive() const
   return {};
 }
 
+void CompositionalCouplingScheme::setSendDataHook(SendDataHook hook)
+{
+  for (auto scheme : allSchemes()) {
+    scheme->setSendDataHook(hook);
+  }
+}
+
 } // namespace precice::cplscheme
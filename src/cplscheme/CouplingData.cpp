@@ -81,13 +81,18 @@ Eigen::MatrixXd CouplingData::getPreviousGradientsAtTime(double relativeDt)
   return _previousTimeStepsStorage.sampleGradients(relativeDt);
 }
 
-void CouplingData::setSampleAtTime(double time, time::Sample sample)
+void CouplingData::setSampleAtTime(double time, const time::Sample &sample)
 {
   PRECICE_ASSERT(not sample.values.hasNaN());
-  this->sample() = sample; // @todo at some point we should not need this anymore, when mapping, acceleration ... directly work on _timeStepsStorage
   _data->setSampleAtTime(time, sample);
 }
 
+void CouplingData::setSampleAtTime(double time, time::Sample &&sample)
+{
+  PRECICE_ASSERT(not sample.values.hasNaN());
+  _data->setSampleAtTime(time, std::move(sample));
+}
+
 bool CouplingData::hasGradient() const
 {
   PRECICE_ASSERT(_data != nullptr);
@@ -181,4 +186,15 @@ bool CouplingData::exchangeSubsteps() const
 {
   return _exchangeSubsteps;
 }
+
+double CouplingData::substepsTolerance() const
+{
+  return _substepsTolerance;
+}
+
+void CouplingData::setSubstepsTolerance(double tolerance)
+{
+  PRECICE_ASSERT(tolerance >= 0.0, tolerance);
+  _substepsTolerance = tolerance;
+}
 } // namespace precice::cplscheme
@@ -62,7 +62,10 @@ public:
   }
 
   /// Add sample at given time to _timeStepsStorage.
-  void setSampleAtTime(double time, time::Sample sample);
+  void setSampleAtTime(double time, const time::Sample &sample);
+
+  /// @copydoc setSampleAtTime(double, const time::Sample &)
+  void setSampleAtTime(double time, time::Sample &&sample);
 
   /// Returns if the data contains gradient data
   bool hasGradient() const;
@@ -108,6 +111,12 @@ public:
 
   bool exchangeSubsteps() const;
 
+  /// Relative tolerance for reducing the substeps sent for this coupling data, 0 sends all substeps
+  double substepsTolerance() const;
+
+  /// Sets the relative tolerance for reducing the sent substeps, see impl::reduceSubsteps()
+  void setSubstepsTolerance(double tolerance);
+
 private:
   logging::Logger _log{"cplscheme::CouplingData"};
 
@@ -123,6 +132,9 @@ private:
   /// If true, all substeps will be sent / received for this coupling data
   bool _exchangeSubsteps;
 
+  /// Relative tolerance for reducing the sent substeps
+  double _substepsTolerance = 0.0;
+
   Direction _direction;
 };
 
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <functional>
 #include <map>
 #include <string>
 #include <vector>
@@ -231,6 +232,17 @@ public:
 
   /// Returns a vector of implicit data to receive in the next advance
   virtual ImplicitData implicitDataToReceive() const = 0;
+
+  /// Callback which is invoked with the ID of a send data right before the data is sent
+  using SendDataHook = std::function<void(DataID)>;
+
+  /**
+   * @brief Sets a hook, which is invoked for every send data right before it is sent.
+   *
+   * The hook allows to prepare send data lazily. For example, the write mapping of
+   * a data can be computed while the previously sent data is still in transit.
+   */
+  virtual void setSendDataHook(SendDataHook hook) = 0;
 };
 
 } // namespace cplscheme
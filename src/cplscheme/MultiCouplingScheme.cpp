@@ -16,6 +16,7 @@
 #include "m2n/SharedPointer.hpp"
 #include "mesh/Data.hpp"
 #include "mesh/Mesh.hpp"
+#include "utils/Helpers.hpp"
 
 namespace precice::cplscheme {
 
@@ -169,9 +170,13 @@ void MultiCouplingScheme::addDataToSend(
     mesh::PtrMesh        mesh,
     bool                 requiresInitialization,
     bool                 exchangeSubsteps,
-    const std::string &  to)
+    const std::string &  to,
+    double               substepsTolerance)
 {
-  PtrCouplingData ptrCplData = addCouplingData(data, std::move(mesh), requiresInitialization, exchangeSubsteps, CouplingData::Direction::Send);
+  const bool      alreadySent = std::any_of(_sendDataVector.begin(), _sendDataVector.end(), [&data](const auto &sendData) { return utils::contained(data->getID(), sendData.second); });
+  PtrCouplingData ptrCplData  = addCouplingData(data, std::move(mesh), requiresInitialization, exchangeSubsteps, CouplingData::Direction::Send);
+  // Data sent to multiple participants shares its CouplingData, which uses the strictest tolerance
+  ptrCplData->setSubstepsTolerance(alreadySent ? std::min(ptrCplData->substepsTolerance(), substepsTolerance) : substepsTolerance);
   PRECICE_DEBUG("Configuring send data to {}", to);
   _sendDataVector[to].emplace(data->getID(), ptrCplData);
 }
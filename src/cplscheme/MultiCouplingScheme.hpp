@@ -51,7 +51,8 @@ public:
       mesh::PtrMesh        mesh,
       bool                 requiresInitialization,
       bool                 exchangeSubsteps,
-      const std::string &  to);
+      const std::string &  to,
+      double               substepsTolerance = 0.0);
 
   /// Adds data to be received on data exchange.
   void addDataToReceive(
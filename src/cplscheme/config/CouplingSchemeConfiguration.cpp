@@ -65,6 +65,7 @@ CouplingSchemeConfiguration::CouplingSchemeConfiguration(
       ATTR_PARTICIPANT("participant"),
       ATTR_INITIALIZE("initialize"),
       ATTR_EXCHANGE_SUBSTEPS("substeps"),
+      ATTR_SUBSTEPS_TOLERANCE("substeps-tolerance"),
       ATTR_TYPE("type"),
       ATTR_FIRST("first"),
       ATTR_SECOND("second"),
@@ -269,6 +270,7 @@ void CouplingSchemeConfiguration::xmlTagCallback(
     std::string nameParticipantTo   = tag.getStringAttributeValue(ATTR_TO);
     bool        initialize          = tag.getBooleanAttributeValue(ATTR_INITIALIZE);
     bool        exchangeSubsteps    = tag.getBooleanAttributeValue(ATTR_EXCHANGE_SUBSTEPS);
+    double      substepsTolerance   = tag.getDoubleAttributeValue(ATTR_SUBSTEPS_TOLERANCE);
 
     PRECICE_CHECK(_meshConfig->hasMeshName(nameMesh) && _meshConfig->getMesh(nameMesh)->hasDataName(nameData),
                   "Mesh \"{}\" with data \"{}\" not defined. "
@@ -281,7 +283,16 @@ void CouplingSchemeConfiguration::xmlTagCallback(
     mesh::PtrData exchangeData = exchangeMesh->data(nameData);
     PRECICE_ASSERT(exchangeData);
 
-    Config::Exchange newExchange{exchangeData, exchangeMesh, nameParticipantFrom, nameParticipantTo, initialize, exchangeSubsteps};
+    PRECICE_CHECK(substepsTolerance >= 0.0,
+                  "The substeps-tolerance of the exchange of data \"{}\" on mesh \"{}\" has to be non-negative, but is {}. "
+                  "Please check the <exchange data=\"{}\" mesh=\"{}\" from=\"{}\" to=\"{}\" /> tag in the <coupling-scheme:... /> of your precice-config.xml.",
+                  nameData, nameMesh, substepsTolerance, nameData, nameMesh, nameParticipantFrom, nameParticipantTo);
+    PRECICE_CHECK(substepsTolerance == 0.0 || exchangeSubsteps,
+                  "You configured a substeps-tolerance for the exchange of data \"{}\" on mesh \"{}\", which only applies to exchanged substeps. "
+                  "Please set substeps=\"true\" or remove the substeps-tolerance in the <exchange data=\"{}\" mesh=\"{}\" from=\"{}\" to=\"{}\" /> tag in the <coupling-scheme:... /> of your precice-config.xml.",
+                  nameData, nameMesh, nameData, nameMesh, nameParticipantFrom, nameParticipantTo);
+
+    Config::Exchange newExchange{exchangeData, exchangeMesh, nameParticipantFrom, nameParticipantTo, initialize, exchangeSubsteps, substepsTolerance};
     PRECICE_CHECK(!_config.hasExchange(newExchange),
                   R"(Data "{}" of mesh "{}" cannot be exchanged multiple times between participants "{}" and "{}". Please remove one of the exchange tags.)",
                   nameData, nameMesh, nameParticipantFrom, nameParticipantTo);
@@ -547,6 +558,8 @@ void CouplingSchemeConfiguration::addTagExchange(
   tagExchange.addAttribute(attrInitialize);
   auto attrExchangeSubsteps = XMLAttribute<bool>(ATTR_EXCHANGE_SUBSTEPS, false).setDocumentation("Should this data exchange substeps?");
   tagExchange.addAttribute(attrExchangeSubsteps);
+  auto attrSubstepsTolerance = XMLAttribute<double>(ATTR_SUBSTEPS_TOLERANCE, 0.0).setDocumentation("Relative tolerance for omitting exchanged substeps, which the receiver can reconstruct by interpolating the waveform from the remaining substeps. The error is measured in the 2-norm per substep. Data with gradients always exchanges all substeps. The default of 0 exchanges all substeps.");
+  tagExchange.addAttribute(attrSubstepsTolerance);
   tag.addSubtag(tagExchange);
 }
 
@@ -1048,7 +1061,7 @@ void CouplingSchemeConfiguration::addDataToBeExchanged(
     const bool exchangeSubsteps = exchange.exchangeSubsteps;
 
     if (from == accessor) {
-      scheme.addDataToSend(exchange.data, exchange.mesh, requiresInitialization, exchangeSubsteps);
+      scheme.addDataToSend(exchange.data, exchange.mesh, requiresInitialization, exchangeSubsteps, exchange.substepsTolerance);
     } else if (to == accessor) {
       checkSubstepExchangeWaveformDegree(exchange);
       scheme.addDataToReceive(exchange.data, exchange.mesh, requiresInitialization, exchangeSubsteps);
@@ -1086,7 +1099,7 @@ void CouplingSchemeConfiguration::addMultiDataToBeExchanged(
     const bool exchangeSubsteps = exchange.exchangeSubsteps;
 
     if (from == accessor) {
-      scheme.addDataToSend(exchange.data, exchange.mesh, initialize, exchangeSubsteps, to);
+      scheme.addDataToSend(exchange.data, exchange.mesh, initialize, exchangeSubsteps, to, exchange.substepsTolerance);
     } else if (to == accessor) {
       scheme.addDataToReceive(exchange.data, exchange.mesh, initialize, exchangeSubsteps, from);
     }
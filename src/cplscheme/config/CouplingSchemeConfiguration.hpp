@@ -103,6 +103,7 @@ private:
   const std::string ATTR_PARTICIPANT;
   const std::string ATTR_INITIALIZE;
   const std::string ATTR_EXCHANGE_SUBSTEPS;
+  const std::string ATTR_SUBSTEPS_TOLERANCE;
   const std::string ATTR_TYPE;
   const std::string ATTR_FIRST;
   const std::string ATTR_SECOND;
@@ -155,6 +156,7 @@ private:
       std::string   to;
       bool          requiresInitialization;
       bool          exchangeSubsteps;
+      double        substepsTolerance;
     };
     std::vector<Exchange>                    exchanges;
     std::vector<ConvergenceMeasureDefintion> convergenceMeasureDefinitions;
@@ -0,0 +1,69 @@
+#include "cplscheme/impl/SubstepReduction.hpp"
+
+#include <algorithm>
+#include <numeric>
+
+#include "math/Bspline.hpp"
+#include "utils/IntraComm.hpp"
+#include "utils/assertion.hpp"
+
+namespace precice::cplscheme::impl {
+
+std::vector<int> reduceSubsteps(const Eigen::VectorXd &times, const Eigen::MatrixXd &values, int degree, double tolerance)
+{
+  PRECICE_ASSERT(times.size() == values.cols(), times.size(), values.cols());
+  PRECICE_ASSERT(tolerance >= 0.0, tolerance);
+  const int nTimes = times.size();
+
+  if (nTimes <= 2 || degree < 1) {
+    std::vector<int> all(nTimes);
+    std::iota(all.begin(), all.end(), 0);
+    return all;
+  }
+
+  // Squared norms of the samples over all ranks
+  std::vector<double> localNorms(nTimes), norms(nTimes);
+  for (int i = 0; i < nTimes; ++i) {
+    localNorms[i] = values.col(i).squaredNorm();
+  }
+  utils::IntraComm::allreduceSum(localNorms, norms);
+
+  std::vector<int>    selected{0, nTimes - 1};
+  std::vector<double> localErrors(nTimes), errors(nTimes);
+  while (static_cast<int>(selected.size()) < nTimes) {
+    std::fill(localErrors.begin(), localErrors.end(), 0.0);
+
+    // Ranks without vertices only take part in the reduction
+    if (values.rows() > 0) {
+      Eigen::VectorXd selectedTimes(selected.size());
+      Eigen::MatrixXd selectedValues(values.rows(), selected.size());
+      for (std::size_t i = 0; i < selected.size(); ++i) {
+        selectedTimes(i)      = times(selected[i]);
+        selectedValues.col(i) = values.col(selected[i]);
+      }
+      const math::Bspline bspline(selectedTimes, selectedValues, std::min<int>(degree, selected.size() - 1));
+      for (int i = 0; i < nTimes; ++i) {
+        if (!std::binary_search(selected.begin(), selected.end(), i)) {
+          localErrors[i] = (bspline.interpolateAt(times(i)) - values.col(i)).squaredNorm();
+        }
+      }
+    }
+    utils::IntraComm::allreduceSum(localErrors, errors);
+
+    int    worst      = -1;
+    double worstError = 0.0;
+    for (int i = 0; i < nTimes; ++i) {
+      if (errors[i] > tolerance * tolerance * norms[i] && errors[i] > worstError) {
+        worst      = i;
+        worstError = errors[i];
+      }
+    }
+    if (worst == -1) {
+      break;
+    }
+    selected.insert(std::upper_bound(selected.begin(), selected.end(), worst), worst);
+  }
+  return selected;
+}
+
+} // namespace precice::cplscheme::impl
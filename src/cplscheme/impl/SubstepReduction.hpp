@@ -0,0 +1,28 @@
+#pragma once
+
+#include <Eigen/Core>
+#include <vector>
+
+namespace precice::cplscheme::impl {
+
+/**
+ * @brief Selects the substeps which are required to reconstruct a waveform within a relative tolerance.
+ *
+ * The receiver of substeps interpolates the received samples using a B-spline of the waveform degree.
+ * Starting from the samples at the beginning and at the end of the time window, the sample with the largest
+ * interpolation error is added until all omitted samples \f$ x_i \f$ fulfil
+ * \f$ \left\lVert \tilde{x}(t_i) - x_i \right\rVert_2 \leq \text{tolerance} \left\lVert x_i \right\rVert_2 \f$,
+ * where \f$ \tilde{x} \f$ interpolates the selected samples.
+ *
+ * The norms are computed over all ranks, which results in the same selection on all ranks.
+ *
+ * @param[in] times timestamps of the samples in ascending order
+ * @param[in] values local values of the samples with one column per timestamp
+ * @param[in] degree degree of the B-spline interpolating the waveform
+ * @param[in] tolerance relative tolerance of the interpolation error
+ *
+ * @returns ascending indices of the selected samples
+ */
+std::vector<int> reduceSubsteps(const Eigen::VectorXd &times, const Eigen::MatrixXd &values, int degree, double tolerance);
+
+} // namespace precice::cplscheme::impl
@@ -218,6 +218,8 @@ public:
     return {};
   }
 
+  void setSendDataHook(SendDataHook) override final {}
+
 private:
   mutable logging::Logger _log{"cplscheme::tests::DummyCouplingScheme"};
 
@@ -0,0 +1,88 @@
+#include <Eigen/Core>
+#include <vector>
+#include "../impl/SubstepReduction.hpp"
+#include "testing/TestContext.hpp"
+#include "testing/Testing.hpp"
+
+using namespace precice;
+using precice::cplscheme::impl::reduceSubsteps;
+
+namespace {
+/// Samples the function f at 9 equidistant times in [0, 1] for two dofs
+template <typename Function>
+std::pair<Eigen::VectorXd, Eigen::MatrixXd> sampleWaveform(Function f)
+{
+  Eigen::VectorXd times  = Eigen::VectorXd::LinSpaced(9, 0.0, 1.0);
+  Eigen::MatrixXd values = Eigen::MatrixXd(2, times.size());
+  for (int i = 0; i < times.size(); ++i) {
+    values(0, i) = f(times(i));
+    values(1, i) = 2 * f(times(i));
+  }
+  return {times, values};
+}
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(CplSchemeTests)
+BOOST_AUTO_TEST_SUITE(SubstepReductionTests)
+
+BOOST_AUTO_TEST_CASE(LinearWaveform)
+{
+  PRECICE_TEST(1_rank);
+  auto [times, values] = sampleWaveform([](double t) { return 1.0 + 3.0 * t; });
+
+  BOOST_TEST(reduceSubsteps(times, values, 1, 1e-10) == (std::vector<int>{0, 8}), boost::test_tools::per_element());
+  BOOST_TEST(reduceSubsteps(times, values, 2, 1e-10) == (std::vector<int>{0, 8}), boost::test_tools::per_element());
+}
+
+BOOST_AUTO_TEST_CASE(QuadraticWaveform)
+{
+  PRECICE_TEST(1_rank);
+  auto [times, values] = sampleWaveform([](double t) { return 1.0 + t * t; });
+
+  // The largest error of the linear interpolant is in the middle of the window
+  BOOST_TEST(reduceSubsteps(times, values, 2, 1e-10) == (std::vector<int>{0, 4, 8}), boost::test_tools::per_element());
+
+  // Linear interpolation requires more substeps for a tight tolerance
+  const auto loose = reduceSubsteps(times, values, 1, 0.1);
+  const auto tight = reduceSubsteps(times, values, 1, 1e-3);
+  BOOST_TEST(loose.size() < tight.size());
+  BOOST_TEST(reduceSubsteps(times, values, 1, 1e-12).size() == 9);
+}
+
+BOOST_AUTO_TEST_CASE(ConstantInterpolation)
+{
+  PRECICE_TEST(1_rank);
+  auto [times, values] = sampleWaveform([](double) { return 1.0; });
+
+  // Constant interpolation requires all substeps
+  BOOST_TEST(reduceSubsteps(times, values, 0, 1e-10).size() == 9);
+}
+
+BOOST_AUTO_TEST_CASE(ParallelWaveform)
+{
+  PRECICE_TEST(""_on(2_ranks).setupIntraComm());
+  auto [times, values] = sampleWaveform([](double t) { return 1.0 + t * t; });
+
+  // Only the secondary rank sees the nonlinearity, but all ranks select the same substeps
+  if (context.isPrimary()) {
+    auto [linearTimes, linearValues] = sampleWaveform([](double t) { return 1.0 + t; });
+    BOOST_TEST(reduceSubsteps(linearTimes, linearValues, 2, 1e-10) == (std::vector<int>{0, 4, 8}), boost::test_tools::per_element());
+  } else {
+    BOOST_TEST(reduceSubsteps(times, values, 2, 1e-10) == (std::vector<int>{0, 4, 8}), boost::test_tools::per_element());
+  }
+}
+
+BOOST_AUTO_TEST_CASE(ParallelWaveformWithEmptyRank)
+{
+  PRECICE_TEST(""_on(2_ranks).setupIntraComm());
+  auto [times, values] = sampleWaveform([](double t) { return 1.0 + t * t; });
+
+  if (context.isPrimary()) {
+    BOOST_TEST(reduceSubsteps(times, Eigen::MatrixXd(0, times.size()), 2, 1e-10) == (std::vector<int>{0, 4, 8}), boost::test_tools::per_element());
+  } else {
+    BOOST_TEST(reduceSubsteps(times, values, 2, 1e-10) == (std::vector<int>{0, 4, 8}), boost::test_tools::per_element());
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END() // SubstepReductionTests
+BOOST_AUTO_TEST_SUITE_END() // CplSchemeTests
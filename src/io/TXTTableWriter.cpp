@@ -8,10 +8,12 @@
 namespace precice::io {
 
 TXTTableWriter::TXTTableWriter(
-    const std::string &filename)
+    const std::string &filename,
+    bool               flushRows)
     : _data(),
       _writeIterator(_data.end()),
-      _outputStream()
+      _outputStream(),
+      _flushRows(flushRows)
 {
   _outputStream.open(filename);
   PRECICE_CHECK(_outputStream, "TXT table writer failed to open file \"{}\"", filename);
@@ -71,7 +73,7 @@ void TXTTableWriter::writeData(
   std::string delimiter = _writeIterator == _data.begin() ? "" : "  ";
   _outputStream << delimiter << std::setw(6) << value;
   _writeIterator++;
-  if (_writeIterator == _data.end()) {
+  if (_flushRows && _writeIterator == _data.end()) {
     _outputStream.flush();
   }
 }
@@ -92,7 +94,7 @@ void TXTTableWriter::writeData(
   std::string delimiter = _writeIterator == _data.begin() ? "" : "  ";
   _outputStream << delimiter << std::setw(15) << value;
   _writeIterator++;
-  if (_writeIterator == _data.end()) {
+  if (_flushRows && _writeIterator == _data.end()) {
     _outputStream.flush();
   }
 }
@@ -117,7 +119,7 @@ void TXTTableWriter::writeData(
     _outputStream << "  " << std::setw(15) << value[i];
   }
   _writeIterator++;
-  if (_writeIterator == _data.end()) {
+  if (_flushRows && _writeIterator == _data.end()) {
     _outputStream.flush();
   }
 }
@@ -141,7 +143,7 @@ void TXTTableWriter::writeData(
     _outputStream << "  " << std::setw(15) << value[i];
   }
   _writeIterator++;
-  if (_writeIterator == _data.end()) {
+  if (_flushRows && _writeIterator == _data.end()) {
     _outputStream.flush();
   }
 }
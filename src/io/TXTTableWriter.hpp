@@ -26,8 +26,13 @@ public:
     VECTOR3D
   };
 
-  /// Constructor, opens file.
-  explicit TXTTableWriter(const std::string &filename);
+  /**
+   * @brief Constructor, opens file.
+   *
+   * @param[in] filename the file to write to
+   * @param[in] flushRows whether to flush every completed row, otherwise rows are buffered until the buffer fills or the file is closed
+   */
+  explicit TXTTableWriter(const std::string &filename, bool flushRows = true);
 
   /**
    * @brief Adds a data entry to the table.
@@ -98,6 +103,8 @@ private:
   std::vector<Data>::const_iterator _writeIterator;
 
   std::ofstream _outputStream;
+
+  bool _flushRows;
 };
 
 } // namespace io
@@ -1,10 +1,14 @@
 #include "LogConfiguration.hpp"
 #include <algorithm>
+#include <array>
 #include <boost/core/null_deleter.hpp>
+#include <boost/log/attributes/constant.hpp>
 #include <boost/log/attributes/mutable_constant.hpp>
 #include <boost/log/core.hpp>
 #include <boost/log/expressions.hpp>
+#include <boost/log/sinks/async_frontend.hpp>
 #include <boost/log/sinks/sink.hpp>
+#include <boost/log/sinks/sync_frontend.hpp>
 #include <boost/log/support/date_time.hpp>
 #include <boost/log/trivial.hpp>
 #include <boost/log/utility/setup/console.hpp>
@@ -121,6 +125,64 @@ public:
   }
 };
 
+namespace {
+
+/// A sink created by setupLogging()
+struct ActiveSink {
+  boost::shared_ptr<boost::log::sinks::sink> sink;
+  /// Whether the filter depends on attributes which change from record to record
+  bool varyingFilter;
+};
+
+/// The sinks created by setupLogging(), which are flushed on exit
+struct ActiveSinks {
+  ActiveSinks()
+  {
+    // Ensures that the core outlives this static
+    boost::log::core::get();
+  }
+
+  ~ActiveSinks()
+  {
+    clear();
+  }
+
+  /// Removes all sinks from the core and writes out pending records
+  void clear()
+  {
+    for (auto &active : sinks) {
+      boost::log::core::get()->remove_sink(active.sink);
+      if (auto async = boost::dynamic_pointer_cast<boost::log::sinks::asynchronous_sink<StreamBackend>>(active.sink)) {
+        async->stop();
+      }
+      active.sink->flush();
+    }
+    sinks.clear();
+  }
+
+  std::vector<ActiveSink> sinks;
+
+  /// Whether records may be logged by sinks which are not created by preCICE
+  bool external = true;
+};
+
+ActiveSinks &activeSinks()
+{
+  static ActiveSinks instance;
+  return instance;
+}
+
+/// Checks whether a filter string refers to attributes which are not known in advance
+bool hasVaryingFilter(std::string const &filter)
+{
+  constexpr std::array<const char *, 6> varyingAttributes{"%File%", "%Line%", "%Function%", "%Scope%", "%TimeStamp%", "%Runtime%"};
+  return std::any_of(varyingAttributes.begin(), varyingAttributes.end(), [&filter](const char *name) {
+    return filter.find(name) != std::string::npos;
+  });
+}
+
+} // namespace
+
 /// Reads a log file, returns a logging configuration.
 LoggingConfiguration readLogConfFile(std::string const &filename)
 {
@@ -178,12 +240,14 @@ void BackendConfiguration::setOption(std::string key, std::string value)
     filter = value;
   if (key == "format")
     format = value;
+  if (key == "async")
+    async = utils::convertStringToBool(value);
 }
 
 bool BackendConfiguration::isValidOption(std::string key)
 {
   boost::algorithm::to_lower(key);
-  return key == "output" || key == "filter" || key == "format" || key == "type";
+  return key == "output" || key == "filter" || key == "format" || key == "type" || key == "async";
 }
 
 void BackendConfiguration::setEnabled(bool enabled)
@@ -214,15 +278,10 @@ void setupLogging(LoggingConfiguration configs, bool enabled)
       << bl::expressions::message;
 
   // Remove active preCICE sinks
-  using sink_ptr = typename boost::shared_ptr<boost::log::sinks::sink>;
-
-  static std::vector<sink_ptr> activeSinks;
-  for (auto &sink : activeSinks) {
-    boost::log::core::get()->remove_sink(sink);
-    sink->flush();
-    sink.reset();
-  }
-  activeSinks.clear();
+  auto &active = activeSinks();
+  active.clear();
+  active.external = !enabled;
+  ++getGlobalLoggingConfig().generation;
 
   // If logging sinks are disabled, then we need to disable the default sink.
   // We do this by adding a NullSink.
@@ -232,7 +291,7 @@ void setupLogging(LoggingConfiguration configs, bool enabled)
       !enabled && noconfigs) {
     auto sink = boost::make_shared<NullSink>();
     boost::log::core::get()->add_sink(sink);
-    activeSinks.emplace_back(std::move(sink));
+    active.sinks.push_back({std::move(sink), false});
     return;
   }
 
@@ -260,22 +319,65 @@ void setupLogging(LoggingConfiguration configs, bool enabled)
     PRECICE_ASSERT(backend != nullptr, "The logging backend was not initialized properly. Check your log config.");
     backend->auto_flush(true);
 
-    // Setup sink
-    auto sink = boost::make_shared<boost::log::sinks::synchronous_sink<StreamBackend>>(backend);
-    sink->set_formatter(boost::log::parse_formatter(config.format));
+    // Setup sink, asynchronous sinks write the records in a dedicated thread
+    auto setup = [&config](auto sink) {
+      sink->set_formatter(boost::log::parse_formatter(config.format));
 
-    if (config.filter.empty()) {
-      sink->set_filter(boost::log::expressions::attr<bool>("preCICE") == true);
+      if (config.filter.empty()) {
+        sink->set_filter(boost::log::expressions::attr<bool>("preCICE") == true);
+      } else {
+        // We extend the filter here to filter all log entries not originating from preCICE.
+        sink->set_filter(boost::log::parse_filter("%preCICE% & ( " + config.filter + " )"));
+      }
+      return sink;
+    };
+    boost::shared_ptr<boost::log::sinks::sink> sink;
+    if (config.async) {
+      sink = setup(boost::make_shared<boost::log::sinks::asynchronous_sink<StreamBackend>>(backend));
     } else {
-      // We extend the filter here to filter all log entries not originating from preCICE.
-      sink->set_filter(boost::log::parse_filter("%preCICE% & ( " + config.filter + " )"));
+      sink = setup(boost::make_shared<boost::log::sinks::synchronous_sink<StreamBackend>>(backend));
     }
 
     boost::log::core::get()->add_sink(sink);
-    activeSinks.emplace_back(std::move(sink));
+    active.sinks.push_back({std::move(sink), hasVaryingFilter(config.filter)});
   }
 }
 
+EnabledSeverities enabledSeverities(std::string const &module)
+{
+  const auto &active = activeSinks();
+  if (active.external) {
+    return {};
+  }
+
+  namespace bl    = boost::log;
+  namespace attrs = boost::log::attributes;
+
+  // Mimics the attributes of a record, which are known before it is created
+  auto willLog = [&](bl::trivial::severity_level severity) {
+    bl::attribute_set recordAttributes;
+    recordAttributes.insert("preCICE", attrs::constant<bool>(true));
+    recordAttributes.insert("Participant", attrs::constant<std::string>(getGlobalLoggingConfig().participant));
+    recordAttributes.insert("Rank", attrs::constant<int>(getGlobalLoggingConfig().rank));
+    recordAttributes.insert("Module", attrs::constant<std::string>(module));
+    recordAttributes.insert("Severity", attrs::constant<bl::trivial::severity_level>(severity));
+    bl::attribute_value_set values(recordAttributes, bl::core::get()->get_thread_attributes(), bl::core::get()->get_global_attributes());
+
+    return std::any_of(active.sinks.begin(), active.sinks.end(), [&values](const ActiveSink &sink) {
+      try {
+        return sink.varyingFilter || sink.sink->will_consume(values);
+      } catch (...) {
+        return true;
+      }
+    });
+  };
+
+  EnabledSeverities enabled;
+  enabled.debug = willLog(bl::trivial::severity_level::debug);
+  enabled.trace = willLog(bl::trivial::severity_level::trace);
+  return enabled;
+}
+
 void setupLogging(std::string const &logConfigFile)
 {
   setupLogging(readLogConfFile(logConfigFile));
@@ -284,11 +386,13 @@ void setupLogging(std::string const &logConfigFile)
 void setMPIRank(int const rank)
 {
   getGlobalLoggingConfig().rank = rank;
+  ++getGlobalLoggingConfig().generation;
 }
 
 void setParticipant(std::string const &participant)
 {
   getGlobalLoggingConfig().participant = participant;
+  ++getGlobalLoggingConfig().generation;
 }
 
 GlobalLoggingConfig &getGlobalLoggingConfig()
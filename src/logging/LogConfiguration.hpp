@@ -1,5 +1,6 @@
 #pragma once
 
+#include <atomic>
 #include <string>
 #include <vector>
 
@@ -18,6 +19,8 @@ struct BackendConfiguration {
   std::string filter  = default_filter;
   std::string format  = default_formatter;
   bool        enabled = true;
+  /// Writes the records in a background thread instead of the logging thread
+  bool        async   = false;
 
   /// Sets on option, overwrites default values.
   void setOption(std::string key, std::string value);
@@ -41,6 +44,19 @@ void setupLogging(std::string const &logConfigFile = "log.conf");
 /// Configures the logging from a LoggingConfiguration
 void setupLogging(LoggingConfiguration configs, bool enabled = true);
 
+/// Which of the verbose severities may be logged
+struct EnabledSeverities {
+  bool debug = true;
+  bool trace = true;
+};
+
+/** Evaluates which verbose severities of a module the configured sinks may log.
+ *
+ * Sinks with filters depending on the log location or time are assumed to log everything,
+ * as are sinks which the application added to Boost.Log itself if logging is disabled.
+ */
+EnabledSeverities enabledSeverities(std::string const &module);
+
 /// Sets the current MPI rank as a logging attribute
 /// @see GlobalLoggingConfig
 void setMPIRank(int const rank);
@@ -55,9 +71,11 @@ void lockConf();
 
 /// Holds global logging data in a central place
 struct GlobalLoggingConfig {
-  std::string participant{""};
-  int         rank{-1};
-  bool        locked{false};
+  std::string           participant{""};
+  int                   rank{-1};
+  bool                  locked{false};
+  /// Incremented on changes which may alter the result of enabledSeverities()
+  std::atomic<unsigned> generation{1};
 };
 
 /// Returns the global logging configuration
@@ -58,7 +58,13 @@
 
 #else // PRECICE_NO_DEBUG_LOG
 
-#define PRECICE_DEBUG(...) _log.debug(PRECICE_LOG_LOCATION, precice::utils::format_or_error(__VA_ARGS__))
+// The message is only formatted if a sink may log it
+#define PRECICE_DEBUG(...)                                                            \
+  do {                                                                                \
+    if (_log.debugEnabled()) {                                                        \
+      _log.debug(PRECICE_LOG_LOCATION, precice::utils::format_or_error(__VA_ARGS__)); \
+    }                                                                                 \
+  } while (false)
 
 #define PRECICE_DEBUG_IF(condition, ...) \
   do {                                   \
@@ -89,8 +95,10 @@
 #include "utils/ArgumentFormatter.hpp"
 
 // Do not put do {...} while (false) here, it will destroy the _tracer_ right after creation
-#define PRECICE_TRACE(...)                                       \
-  precice::logging::Tracer _tracer_(_log, PRECICE_LOG_LOCATION); \
-  _log.trace(PRECICE_LOG_LOCATION, std::string{"Entering "} + __func__ + PRECICE_LOG_ARGUMENTS(__VA_ARGS__))
+#define PRECICE_TRACE(...)                                                                                      \
+  precice::logging::Tracer _tracer_(_log, PRECICE_LOG_LOCATION);                                                \
+  if (_log.traceEnabled()) {                                                                                    \
+    _log.trace(PRECICE_LOG_LOCATION, std::string{"Entering "} + __func__ + PRECICE_LOG_ARGUMENTS(__VA_ARGS__)); \
+  }
 
 #endif // ! PRECICE_NO_TRACE_LOG
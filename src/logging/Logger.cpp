@@ -2,9 +2,14 @@
 #include <boost/log/attributes/function.hpp>
 #include <boost/log/attributes/named_scope.hpp>
 #include <boost/log/attributes/timer.hpp>
+#include <boost/log/core.hpp>
+#include <boost/log/detail/light_rw_mutex.hpp>
+#include <boost/log/detail/locks.hpp>
 #include <boost/log/sources/severity_feature.hpp>
+#include <boost/log/sources/threading_models.hpp>
 #include <boost/log/trivial.hpp>
 #include <boost/log/utility/setup/common_attributes.hpp>
+#include <atomic>
 #include <utility>
 #include <utils/assertion.hpp>
 
@@ -21,7 +26,7 @@ public:
   using threading_model = typename BaseT::threading_model;
 
   using open_record_lock = typename boost::log::strictest_lock<
-      boost::lock_guard<threading_model>,
+      boost::log::aux::exclusive_lock_guard<threading_model>,
       typename BaseT::open_record_lock,
       typename BaseT::add_attribute_lock,
       typename BaseT::remove_attribute_lock>::type;
@@ -84,12 +89,15 @@ boost::log::record precice_feature<BaseT>::open_record_unlocked(ArgsT const &arg
 struct precice_log : public boost::mpl::quote1<precice_feature> {
 };
 
-/// The boost logger that combines required featrues
+/** The boost logger that combines required featrues
+ *
+ * Loggers are shared between the calling thread and the thread completing an asynchronous advance.
+ */
 template <class BaseLogger>
 using BoostLogger = boost::log::sources::basic_composite_logger<
     char,
     BaseLogger,
-    boost::log::sources::single_thread_model,
+    boost::log::sources::multi_thread_model<boost::log::aux::light_rw_mutex>,
     boost::log::sources::features<
         boost::log::sources::severity<boost::log::trivial::severity_level>,
         precice_log>>;
@@ -104,10 +112,25 @@ public:
    * @param[in] module the name of the module.
    */
   explicit LoggerImpl(std::string_view module);
+
+  /// Copies the logger, the copy reevaluates the enabled severities on first use
+  LoggerImpl(const LoggerImpl &other);
+
+  /// Returns the severities which may be logged, reevaluating them if the configuration changed
+  EnabledSeverities enabledSeverities();
+
+private:
+  std::string _module;
+
+  /// The generation of the GlobalLoggingConfig the cached severities were evaluated for
+  std::atomic<unsigned> _generation{0};
+
+  std::atomic<EnabledSeverities> _enabled{EnabledSeverities{}};
 };
 
 /// Registers attributes that don't depend on the \ref LogLocation
 Logger::LoggerImpl::LoggerImpl(std::string_view module)
+    : _module(module)
 {
   namespace attrs = boost::log::attributes;
 
@@ -125,6 +148,21 @@ Logger::LoggerImpl::LoggerImpl(std::string_view module)
   add_attribute("Scope", attrs::named_scope());
 }
 
+Logger::LoggerImpl::LoggerImpl(const LoggerImpl &other)
+    : BoostLogger<Logger::LoggerImpl>(static_cast<const BoostLogger<Logger::LoggerImpl> &>(other)), _module(other._module)
+{
+}
+
+EnabledSeverities Logger::LoggerImpl::enabledSeverities()
+{
+  // The release store of the generation publishes the severities evaluated for it
+  if (const auto generation = getGlobalLoggingConfig().generation.load(); _generation.load(std::memory_order_acquire) != generation) {
+    _enabled.store(logging::enabledSeverities(_module), std::memory_order_relaxed);
+    _generation.store(generation, std::memory_order_release);
+  }
+  return _enabled.load(std::memory_order_relaxed);
+}
+
 Logger::Logger(std::string_view module)
     : _impl(new LoggerImpl{module}) {}
 
@@ -158,6 +196,8 @@ void Logger::error(LogLocation loc, std::string_view mess) noexcept
 {
   try {
     PRECICE_LOG_IMPL(*_impl, boost::log::trivial::severity_level::error, loc) << mess;
+    // Errors usually end the program, so asynchronous sinks have to write them out now
+    boost::log::core::get()->flush();
   } catch (...) {
   }
 }
@@ -196,4 +236,14 @@ void Logger::trace(LogLocation loc, std::string_view mess) noexcept
 
 #undef PRECICE_LOG_IMPL
 
+bool Logger::debugEnabled() noexcept
+{
+  return _impl->enabledSeverities().debug;
+}
+
+bool Logger::traceEnabled() noexcept
+{
+  return _impl->enabledSeverities().trace;
+}
+
 } // namespace precice::logging
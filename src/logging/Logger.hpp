@@ -37,6 +37,17 @@ public:
   void trace(LogLocation loc, std::string_view mess) noexcept;
   ///@}
 
+  ///@name Severity checks
+  ///@{
+  /** Checks whether debug or trace messages of this logger may be logged at all.
+   *
+   * This allows to skip formatting messages which would be filtered anyway.
+   * The result is cached and reevaluated only after the logging configuration changed.
+   */
+  bool debugEnabled() noexcept;
+  bool traceEnabled() noexcept;
+  ///@}
+
 private:
   /// Forward declaration of the implementation of the logger
   class LoggerImpl;
@@ -51,6 +51,11 @@ LogConfiguration::LogConfiguration(
                          .setDocumentation("Enables the sink");
   tagSink.addAttribute(attrEnabled);
 
+  auto attrAsync = makeXMLAttribute("async", false)
+                       .setDocumentation("Writes the log entries in a background thread, which keeps slow outputs away from the solver. "
+                                         "Entries pending on a crash may be lost.");
+  tagSink.addAttribute(attrAsync);
+
   tagLog.addSubtag(tagSink);
   parent.addSubtag(tagLog);
 }
@@ -68,6 +73,7 @@ void LogConfiguration::xmlTagCallback(
     config.setOption("filter", tag.getStringAttributeValue("filter"));
     config.setOption("format", tag.getStringAttributeValue("format"));
     config.setEnabled(tag.getBooleanAttributeValue("enabled"));
+    config.async = tag.getBooleanAttributeValue("async");
     _logconfig.push_back(config);
   }
 }
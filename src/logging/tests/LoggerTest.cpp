@@ -0,0 +1,144 @@
+#include <boost/test/tools/interface.hpp>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include "logging/LogConfiguration.hpp"
+#include "logging/Logger.hpp"
+#include "testing/TestContext.hpp"
+#include "testing/Testing.hpp"
+
+using namespace precice;
+using namespace precice::logging;
+
+namespace {
+
+/// Allows to reconfigure the logging and restores the logging of the test suite afterwards
+struct LoggingFixture {
+  LoggingFixture()
+      : rank(getGlobalLoggingConfig().rank)
+  {
+    getGlobalLoggingConfig().locked = false;
+  }
+
+  ~LoggingFixture()
+  {
+    setMPIRank(rank);
+    getGlobalLoggingConfig().locked = false;
+    testing::setupTestLogging();
+    std::filesystem::remove(logFile);
+  }
+
+  /// Configures a single sink, which writes the messages accepted by the filter to the log file
+  void setupFileSink(const std::string &filter, bool async = false)
+  {
+    BackendConfiguration config;
+    config.type   = "file";
+    config.output = logFile;
+    config.filter = filter;
+    config.format = "%Message%";
+    config.async  = async;
+    setupLogging({config});
+  }
+
+  /// Returns the current content of the log file
+  std::string readLogFile() const
+  {
+    std::ifstream ifs(logFile);
+    return {std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>()};
+  }
+
+  int rank;
+  /// The fixture is set up on all ranks, hence, each rank uses its own log file
+  std::string logFile{"logger-test." + std::to_string(rank) + ".log"};
+};
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(LoggingTests)
+BOOST_FIXTURE_TEST_SUITE(LoggerTests, LoggingFixture)
+
+BOOST_AUTO_TEST_CASE(SeverityFilters)
+{
+  PRECICE_TEST(1_rank);
+  Logger log{"logger-test"};
+
+  setupFileSink("%Severity% >= debug");
+  BOOST_TEST(log.debugEnabled());
+  BOOST_TEST(!log.traceEnabled());
+
+  // Reconfiguring invalidates the cached severities
+  setupFileSink("%Severity% >= info");
+  BOOST_TEST(!log.debugEnabled());
+  BOOST_TEST(!log.traceEnabled());
+
+  setupFileSink("%Severity% >= trace");
+  BOOST_TEST(log.debugEnabled());
+  BOOST_TEST(log.traceEnabled());
+
+  // Copies evaluate the severities for the current configuration
+  setupFileSink("%Severity% >= debug");
+  Logger copy{log};
+  BOOST_TEST(copy.debugEnabled());
+  BOOST_TEST(!copy.traceEnabled());
+}
+
+BOOST_AUTO_TEST_CASE(ModuleAndRankFilters)
+{
+  PRECICE_TEST(1_rank);
+  Logger log{"logger-test"};
+  Logger other{"other-test"};
+
+  setupFileSink("(%Severity% >= debug) and (%Module% contains other)");
+  BOOST_TEST(!log.debugEnabled());
+  BOOST_TEST(other.debugEnabled());
+
+  // Changing the rank invalidates the cached severities
+  setupFileSink("(%Severity% >= debug) and (%Rank% = 1)");
+  setMPIRank(0);
+  BOOST_TEST(!log.debugEnabled());
+  setMPIRank(1);
+  BOOST_TEST(log.debugEnabled());
+  BOOST_TEST(!log.traceEnabled());
+
+  // Filters on the log location are only known per record, hence, everything may be logged
+  setupFileSink("(%Severity% >= debug) and (%Line% > 0)");
+  BOOST_TEST(log.debugEnabled());
+  BOOST_TEST(log.traceEnabled());
+}
+
+BOOST_AUTO_TEST_CASE(Emission)
+{
+  PRECICE_TEST(1_rank);
+  Logger log{"logger-test"};
+
+  for (bool async : {false, true}) {
+    BOOST_TEST_CONTEXT("async = " << async)
+    {
+      setupFileSink("%Severity% >= debug", async);
+      log.trace(PRECICE_LOG_LOCATION, "filtered trace");
+      log.debug(PRECICE_LOG_LOCATION, "emitted debug");
+      log.info(PRECICE_LOG_LOCATION, "emitted info");
+
+      // Reconfiguring writes out pending records of asynchronous sinks
+      setupLogging({}, false);
+      BOOST_TEST(readLogFile() == "emitted debug\nemitted info\n");
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(AsyncFlushOnError)
+{
+  PRECICE_TEST(1_rank);
+  Logger log{"logger-test"};
+
+  setupFileSink("%Severity% >= info", true);
+  log.info(PRECICE_LOG_LOCATION, "emitted info");
+  log.error(PRECICE_LOG_LOCATION, "emitted error");
+
+  // Errors write out all pending records immediately
+  BOOST_TEST(readLogFile() == "emitted info\nemitted error\n");
+}
+
+BOOST_AUTO_TEST_SUITE_END() // LoggerTests
+BOOST_AUTO_TEST_SUITE_END() // LoggingTests
@@ -641,6 +641,8 @@ void PointToPointCommunication::receive(precice::span<double> itemsToReceive, in
     mapping.request = _communication->aReceive(span<double>{mapping.recvBuffer}, mapping.remoteRank);
   }
 
+  // Accumulate the received values in the fixed order of the remote ranks.
+  // Vertices shared by several ranks are thus summed up in the same order in every run.
   for (auto &mapping : _mappings) {
     mapping.request->wait();
 
@@ -1,4 +1,5 @@
 #include <Eigen/Core>
+#include <Eigen/SparseCore>
 #include <algorithm>
 #include <memory>
 #include <ostream>
@@ -27,39 +28,62 @@ BarycentricBaseMapping::BarycentricBaseMapping(Constraint constraint, int dimens
 {
 }
 
+namespace {
+using ValueMatrix         = Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+using InterpolationMatrix = Eigen::Map<const Eigen::SparseMatrix<double, Eigen::RowMajor>>;
+} // namespace
+
 void BarycentricBaseMapping::clear()
 {
   PRECICE_TRACE();
-  _interpolations.clear();
+  // Swap with empty containers to release the memory
+  std::vector<int>{0}.swap(_rowOffsets);
+  std::vector<int>().swap(_columnIndices);
+  std::vector<double>().swap(_weights);
   _hasComputedMapping = false;
 }
 
+std::size_t BarycentricBaseMapping::nInterpolations() const
+{
+  return _rowOffsets.size() - 1;
+}
+
+void BarycentricBaseMapping::reserveInterpolations(std::size_t rows, std::size_t elementsPerRow)
+{
+  _rowOffsets.reserve(rows + 1);
+  _columnIndices.reserve(rows * elementsPerRow);
+  _weights.reserve(rows * elementsPerRow);
+}
+
+void BarycentricBaseMapping::addInterpolation(const Polation &polation)
+{
+  for (const auto &elem : polation.getWeightedElements()) {
+    _columnIndices.push_back(elem.vertexID);
+    _weights.push_back(elem.weight);
+  }
+  _rowOffsets.push_back(static_cast<int>(_columnIndices.size()));
+}
+
 void BarycentricBaseMapping::mapConservative(const time::Sample &inData, Eigen::VectorXd &outData)
 {
   PRECICE_TRACE();
   precice::profiling::Event e("map.bbm.mapData.From" + input()->getName() + "To" + output()->getName(), profiling::Synchronize);
   PRECICE_ASSERT(getConstraint() == CONSERVATIVE);
   PRECICE_DEBUG("Map conservative using {}", getName());
-  PRECICE_ASSERT(_interpolations.size() == input()->nVertices(),
-                 _interpolations.size(), input()->nVertices());
-  const int              dimensions = inData.dataDims;
-  const Eigen::VectorXd &inValues   = inData.values;
-  Eigen::VectorXd &      outValues  = outData;
-
-  // For each input vertex, distribute the conserved data among the relevant output vertices
-  // Do it for all dimensions (i.e. components if data is a vector)
-  for (size_t i = 0; i < input()->nVertices(); i++) {
-    const size_t inOffset = i * dimensions;
-    const auto & elems    = _interpolations[i].getWeightedElements();
-    for (const auto &elem : elems) {
-      size_t outOffset = static_cast<size_t>(elem.vertexID) * dimensions;
-      for (int dim = 0; dim < dimensions; dim++) {
-        PRECICE_ASSERT(outOffset + dim < (size_t) outValues.size());
-        PRECICE_ASSERT(inOffset + dim < (size_t) inValues.size());
-        outValues(outOffset + dim) += elem.weight * inValues(inOffset + dim);
-      }
-    }
-  }
+  PRECICE_ASSERT(nInterpolations() == input()->nVertices(),
+                 nInterpolations(), input()->nVertices());
+  const Eigen::Index dimensions = inData.dataDims;
+  const Eigen::Index nIn        = input()->nVertices();
+  const Eigen::Index nOut       = output()->nVertices();
+  PRECICE_ASSERT(inData.values.size() == nIn * dimensions, inData.values.size(), nIn, dimensions);
+  PRECICE_ASSERT(outData.size() == nOut * dimensions, outData.size(), nOut, dimensions);
+
+  // For each input vertex, distribute the conserved data among the relevant output vertices.
+  // The values are stored per vertex, which is a row-major matrix with one column per component.
+  InterpolationMatrix           interpolations(nIn, nOut, _weights.size(), _rowOffsets.data(), _columnIndices.data(), _weights.data());
+  Eigen::Map<const ValueMatrix> inValues(inData.values.data(), nIn, dimensions);
+  Eigen::Map<ValueMatrix>       outValues(outData.data(), nOut, dimensions);
+  outValues.noalias() += interpolations.transpose() * inValues;
 }
 
 void BarycentricBaseMapping::mapConsistent(const time::Sample &inData, Eigen::VectorXd &outData)
@@ -67,27 +91,20 @@ void BarycentricBaseMapping::mapConsistent(const time::Sample &inData, Eigen::Ve
   PRECICE_TRACE();
   precice::profiling::Event e("map.bbm.mapData.From" + input()->getName() + "To" + output()->getName(), profiling::Synchronize);
   PRECICE_DEBUG("Map {} using {}", (hasConstraint(CONSISTENT) ? "consistent" : "scaled-consistent"), getName());
-  PRECICE_ASSERT(_interpolations.size() == output()->nVertices(),
-                 _interpolations.size(), output()->nVertices());
-
-  const int              dimensions = inData.dataDims;
-  const Eigen::VectorXd &inValues   = inData.values;
-  Eigen::VectorXd &      outValues  = outData;
-
-  // For each output vertex, compute the linear combination of input vertices
-  // Do it for all dimensions (i.e. components if data is a vector)
-  for (size_t i = 0; i < output()->nVertices(); i++) {
-    const auto &elems     = _interpolations[i].getWeightedElements();
-    size_t      outOffset = i * dimensions;
-    for (const auto &elem : elems) {
-      const size_t inOffset = static_cast<size_t>(elem.vertexID) * dimensions;
-      for (int dim = 0; dim < dimensions; dim++) {
-        PRECICE_ASSERT(outOffset + dim < (size_t) outValues.size());
-        PRECICE_ASSERT(inOffset + dim < (size_t) inValues.size());
-        outValues(outOffset + dim) += elem.weight * inValues(inOffset + dim);
-      }
-    }
-  }
+  PRECICE_ASSERT(nInterpolations() == output()->nVertices(),
+                 nInterpolations(), output()->nVertices());
+  const Eigen::Index dimensions = inData.dataDims;
+  const Eigen::Index nIn        = input()->nVertices();
+  const Eigen::Index nOut       = output()->nVertices();
+  PRECICE_ASSERT(inData.values.size() == nIn * dimensions, inData.values.size(), nIn, dimensions);
+  PRECICE_ASSERT(outData.size() == nOut * dimensions, outData.size(), nOut, dimensions);
+
+  // For each output vertex, compute the linear combination of input vertices.
+  // The values are stored per vertex, which is a row-major matrix with one column per component.
+  InterpolationMatrix           interpolations(nOut, nIn, _weights.size(), _rowOffsets.data(), _columnIndices.data(), _weights.data());
+  Eigen::Map<const ValueMatrix> inValues(inData.values.data(), nIn, dimensions);
+  Eigen::Map<ValueMatrix>       outValues(outData.data(), nOut, dimensions);
+  outValues.noalias() += interpolations * inValues;
 }
 
 void BarycentricBaseMapping::tagMeshFirstRound()
@@ -112,10 +129,10 @@ void BarycentricBaseMapping::tagMeshFirstRound()
   std::unordered_set<int> tagged;
   const std::size_t       max_count = origins->nVertices();
 
-  for (const Polation &interpolation : _interpolations) {
-    for (const auto &elem : interpolation.getWeightedElements()) {
-      if (!math::equals(elem.weight, 0.0)) {
-        tagged.insert(elem.vertexID);
+  for (std::size_t row = 0; row < nInterpolations(); ++row) {
+    for (int i = _rowOffsets[row]; i < _rowOffsets[row + 1]; ++i) {
+      if (!math::equals(_weights[i], 0.0)) {
+        tagged.insert(_columnIndices[i]);
       }
     }
     // Shortcut if all vertices are tagged
@@ -10,7 +10,10 @@ namespace mapping {
 
 /**
  * @brief Base class for interpolation based mappings, where mapping is done using a geometry-based linear combination of input values.
- *  Subclasses differ by the way computeMapping() fills the _interpolations and by mesh tagging. Mapping itself is shared.
+ *  Subclasses differ by the way computeMapping() fills the interpolation matrix and by mesh tagging. Mapping itself is shared.
+ *
+ * The interpolations are stored as sparse matrix in compressed row storage (CSR), with one row per interpolated vertex.
+ * Mapping then reduces to a sparse matrix product, which handles all components of the data at once.
  */
 class BarycentricBaseMapping : public Mapping {
 public:
@@ -25,6 +28,18 @@ public:
 private:
   logging::Logger _log{"mapping::BarycentricBaseMapping"};
 
+  /// Offsets of the rows into _columnIndices and _weights, the last entry is the number of nonzeros
+  std::vector<int> _rowOffsets{0};
+
+  /// The vertex IDs of the weighted elements
+  std::vector<int> _columnIndices;
+
+  /// The weights of the weighted elements
+  std::vector<double> _weights;
+
+  /// Returns the number of rows, i.e., the number of interpolated vertices
+  std::size_t nInterpolations() const;
+
 protected:
   /// @copydoc Mapping::mapConservative
   void mapConservative(const time::Sample &inData, Eigen::VectorXd &outData) override;
@@ -32,7 +47,11 @@ protected:
   /// @copydoc Mapping::mapConsistent
   void mapConsistent(const time::Sample &inData, Eigen::VectorXd &outData) override;
 
-  std::vector<Polation> _interpolations;
+  /// Reserves space for the given number of interpolations with the given number of weighted elements each
+  void reserveInterpolations(std::size_t rows, std::size_t elementsPerRow);
+
+  /// Appends the weighted elements of the given polation as next row of the interpolation matrix
+  void addInterpolation(const Polation &polation);
 };
 
 } // namespace mapping
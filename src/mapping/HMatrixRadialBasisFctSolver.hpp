@@ -0,0 +1,334 @@
+#pragma once
+
+#include <Eigen/QR>
+#include <array>
+#include <memory>
+#include <vector>
+
+#include "logging/LogMacros.hpp"
+#include "logging/Logger.hpp"
+#include "mapping/RadialBasisFctSolver.hpp"
+#include "mapping/config/MappingConfiguration.hpp"
+#include "mapping/config/MappingConfigurationTypes.hpp"
+#include "mapping/impl/GMRES.hpp"
+#include "mapping/impl/HierarchicalMatrix.hpp"
+#include "mesh/Mesh.hpp"
+#include "profiling/Event.hpp"
+#include "utils/assertion.hpp"
+
+namespace precice {
+namespace mapping {
+
+/**
+ * This class assembles and solves an RBF system, given an input mesh and an output mesh with relevant vertex IDs.
+ * The interpolation and the evaluation matrix are approximated by hierarchical matrices, i.e., the interaction of
+ * well-separated vertex clusters is compressed to low-rank blocks using adaptive cross approximation. This reduces
+ * storage and matrix-vector products from O(N^2) to O(N log N) for globally supported basis functions. The
+ * interpolation system is solved using restarted GMRES, preconditioned by the dense diagonal blocks for strictly
+ * positive definite basis functions.
+ */
+template <typename RADIAL_BASIS_FUNCTION_T>
+class HMatrixRadialBasisFctSolver {
+public:
+  using BASIS_FUNCTION_T = RADIAL_BASIS_FUNCTION_T;
+
+  /// Assembles the hierarchical system matrices and the preconditioner
+  template <typename IndexContainer>
+  HMatrixRadialBasisFctSolver(RADIAL_BASIS_FUNCTION_T basisFunction, const mesh::Mesh &inputMesh, const IndexContainer &inputIDs,
+                              const mesh::Mesh &outputMesh, const IndexContainer &outputIDs, std::vector<bool> deadAxis, Polynomial polynomial,
+                              MappingConfiguration::HMatrixParameter hmatrixParameter);
+
+  /// Maps the given input data
+  Eigen::VectorXd solveConsistent(const Eigen::VectorXd &inputData, Polynomial polynomial) const;
+
+  /// Maps the given input data
+  Eigen::VectorXd solveConservative(const Eigen::VectorXd &inputData, Polynomial polynomial) const;
+
+  void clear();
+
+  Eigen::Index getInputSize() const;
+
+  Eigen::Index getOutputSize() const;
+
+  /// Returns the ratio of stored entries of the compressed matrices compared to dense matrices
+  double getCompressionRatio() const;
+
+private:
+  mutable precice::logging::Logger _log{"mapping::HMatrixRadialBasisFctSolver"};
+
+  MappingConfiguration::HMatrixParameter _parameter;
+
+  /// Cluster trees of the input and the output vertices
+  std::unique_ptr<impl::ClusterTree> _inputTree;
+  std::unique_ptr<impl::ClusterTree> _outputTree;
+
+  /// Interpolation matrix (input x input) in tree order
+  std::unique_ptr<impl::HierarchicalMatrix> _matrixC;
+
+  /// Evaluation matrix (output x input) in tree order
+  std::unique_ptr<impl::HierarchicalMatrix> _matrixA;
+
+  /// Decompositions of the diagonal blocks of C used as preconditioner
+  std::vector<std::pair<Eigen::Index, Eigen::ColPivHouseholderQR<Eigen::MatrixXd>>> _diagonalBlocks;
+
+  /// Polynomial matrix of the input mesh in tree order
+  Eigen::MatrixXd _matrixQ;
+
+  /// Polynomial matrix of the output mesh in tree order
+  Eigen::MatrixXd _matrixV;
+
+  /// Decomposition of the polynomial (for separate polynomial)
+  Eigen::ColPivHouseholderQR<Eigen::MatrixXd> _qrMatrixQ;
+
+  /// Solves the interpolation system in tree order, including the polynomial constraints for polynomial=ON
+  Eigen::VectorXd solveInterpolationSystem(const Eigen::VectorXd &rhs, Polynomial polynomial) const;
+
+  /// Applies the block-Jacobi preconditioner to the RBF part of x
+  void applyPreconditioner(const Eigen::VectorXd &x, Eigen::VectorXd &y) const;
+};
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+template <typename IndexContainer>
+HMatrixRadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::HMatrixRadialBasisFctSolver(RADIAL_BASIS_FUNCTION_T basisFunction, const mesh::Mesh &inputMesh, const IndexContainer &inputIDs,
+                                                                                  const mesh::Mesh &outputMesh, const IndexContainer &outputIDs, std::vector<bool> deadAxis, Polynomial polynomial,
+                                                                                  MappingConfiguration::HMatrixParameter hmatrixParameter)
+    : _parameter(hmatrixParameter)
+{
+  PRECICE_TRACE();
+  PRECICE_CHECK(!(RADIAL_BASIS_FUNCTION_T::isStrictlyPositiveDefinite() && polynomial == Polynomial::ON), "The integrated polynomial (polynomial=\"on\") is not supported for the selected radial-basis function. Please select another radial-basis function or change the polynomial configuration.");
+  PRECICE_DEBUG("Using hierarchical matrices with admissibility {}, leaf size {} and compression tolerance {} with GMRES, max. iterations {} and residual reduction {}",
+                _parameter.admissibility, _parameter.leafSize, _parameter.compressionTolerance,
+                _parameter.maxIterations, _parameter.residualNorm);
+
+  // Convert dead axis vector into an active axis array so that we can handle the reduction more easily
+  std::array<bool, 3> activeAxis({{false, false, false}});
+  std::transform(deadAxis.begin(), deadAxis.end(), activeAxis.begin(), [](const auto ax) { return !ax; });
+
+  // Dead axes are projected out, such that plain euclidean distances can be used in the trees
+  auto collectPoints = [&activeAxis](const mesh::Mesh &mesh, const IndexContainer &IDs) {
+    std::vector<impl::ClusterTree::Point> points;
+    points.reserve(IDs.size());
+    for (const auto &id : IDs) {
+      auto coords = mesh.vertex(id).rawCoords();
+      for (int d = 0; d < 3; ++d) {
+        coords[d] *= static_cast<int>(activeAxis[d]);
+      }
+      points.push_back(coords);
+    }
+    return points;
+  };
+
+  {
+    precice::profiling::Event e("map.rbf.hmatrix.buildClusterTrees");
+    _inputTree  = std::make_unique<impl::ClusterTree>(collectPoints(inputMesh, inputIDs), _parameter.leafSize);
+    _outputTree = std::make_unique<impl::ClusterTree>(collectPoints(outputMesh, outputIDs), _parameter.leafSize);
+  }
+
+  auto kernelBetween = [&basisFunction](const impl::ClusterTree &rows, const impl::ClusterTree &cols) {
+    return [&basisFunction, &rowPoints = rows.points(), &colPoints = cols.points()](Eigen::Index i, Eigen::Index j) {
+      return basisFunction.evaluate(std::sqrt(computeSquaredDifference(rowPoints[i], colPoints[j])));
+    };
+  };
+
+  {
+    precice::profiling::Event e("map.rbf.hmatrix.assembleC");
+    _matrixC = std::make_unique<impl::HierarchicalMatrix>(*_inputTree, *_inputTree, kernelBetween(*_inputTree, *_inputTree),
+                                                          _parameter.admissibility, _parameter.compressionTolerance);
+  }
+  {
+    precice::profiling::Event e("map.rbf.hmatrix.assembleA");
+    _matrixA = std::make_unique<impl::HierarchicalMatrix>(*_outputTree, *_inputTree, kernelBetween(*_outputTree, *_inputTree),
+                                                          _parameter.admissibility, _parameter.compressionTolerance);
+  }
+  PRECICE_DEBUG("Compressed the RBF matrices to {:.2f}% of their dense storage", 100 * getCompressionRatio());
+
+  // The diagonal blocks of C are the interactions of the leaf clusters with themselves. A block-Jacobi
+  // preconditioner only pays off for strictly positive definite functions: for conditionally positive
+  // definite functions, such as thin-plate splines, the leaf-local inverses amplify the growing far-field
+  // and slow down the convergence considerably.
+  for (const auto &block : _matrixC->denseBlocks()) {
+    if (RADIAL_BASIS_FUNCTION_T::isStrictlyPositiveDefinite() && block.rowBegin == block.colBegin && block.matrix.rows() == block.matrix.cols()) {
+      auto decomposition = block.matrix.colPivHouseholderQr();
+      if (decomposition.isInvertible()) {
+        _diagonalBlocks.emplace_back(block.rowBegin, std::move(decomposition));
+      }
+    }
+  }
+
+  if (polynomial == Polynomial::OFF) {
+    return;
+  }
+
+  // Build the polynomial matrices, reducing the polynomial degree for badly conditioned polynomial systems
+  auto         localActiveAxis = activeAxis;
+  unsigned int polyParams      = 4 - std::count(localActiveAxis.begin(), localActiveAxis.end(), false);
+  Eigen::MatrixXd Q;
+  do {
+    Q.resize(inputIDs.size(), polyParams);
+    fillPolynomialEntries(Q, inputMesh, inputIDs, 0, localActiveAxis);
+
+    if (polynomial == Polynomial::ON) {
+      break;
+    }
+    Eigen::JacobiSVD<Eigen::MatrixXd> svd(Q);
+    PRECICE_ASSERT(svd.singularValues().size() > 0);
+    const double conditionNumber = svd.singularValues()(0) / std::max(svd.singularValues()(svd.singularValues().size() - 1), math::NUMERICAL_ZERO_DIFFERENCE);
+    PRECICE_DEBUG("Condition number of the polynomial system: {}", conditionNumber);
+    if (conditionNumber <= 1e5) {
+      break;
+    }
+    reduceActiveAxis(inputMesh, inputIDs, localActiveAxis);
+    polyParams = 4 - std::count(localActiveAxis.begin(), localActiveAxis.end(), false);
+  } while (true);
+
+  Eigen::MatrixXd V(outputIDs.size(), polyParams);
+  fillPolynomialEntries(V, outputMesh, outputIDs, 0, localActiveAxis);
+
+  // Reorder the rows to tree order
+  _matrixQ.resize(Q.rows(), Q.cols());
+  for (Eigen::Index i = 0; i < Q.rows(); ++i) {
+    _matrixQ.row(i) = Q.row(_inputTree->order()[i]);
+  }
+  _matrixV.resize(V.rows(), V.cols());
+  for (Eigen::Index i = 0; i < V.rows(); ++i) {
+    _matrixV.row(i) = V.row(_outputTree->order()[i]);
+  }
+
+  if (polynomial == Polynomial::SEPARATE) {
+    _qrMatrixQ = _matrixQ.colPivHouseholderQr();
+  }
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+void HMatrixRadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::applyPreconditioner(const Eigen::VectorXd &x, Eigen::VectorXd &y) const
+{
+  // Entries without a factorized diagonal block, including the polynomial part, remain unchanged
+  y = x;
+  for (const auto &[begin, decomposition] : _diagonalBlocks) {
+    const auto size       = decomposition.rows();
+    y.segment(begin, size) = decomposition.solve(x.segment(begin, size));
+  }
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+Eigen::VectorXd HMatrixRadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::solveInterpolationSystem(const Eigen::VectorXd &rhs, Polynomial polynomial) const
+{
+  precice::profiling::Event e("map.rbf.hmatrix.solve");
+  const Eigen::Index n = _matrixC->rows();
+
+  impl::LinearOperator op;
+  if (polynomial == Polynomial::ON) {
+    // Saddle point system [C Q; Q^T 0]
+    op = [this, n](const Eigen::VectorXd &x, Eigen::VectorXd &y) {
+      Eigen::VectorXd Cx;
+      _matrixC->multiply(x.head(n), Cx);
+      y.resize(x.size());
+      y.head(n) = Cx + _matrixQ * x.tail(_matrixQ.cols());
+      y.tail(_matrixQ.cols()) = _matrixQ.transpose() * x.head(n);
+    };
+  } else {
+    op = [this](const Eigen::VectorXd &x, Eigen::VectorXd &y) { _matrixC->multiply(x, y); };
+  }
+  impl::LinearOperator preconditioner = [this](const Eigen::VectorXd &x, Eigen::VectorXd &y) { applyPreconditioner(x, y); };
+
+  Eigen::VectorXd solution = Eigen::VectorXd::Zero(rhs.size());
+  const auto      result   = impl::solveGMRES(op, preconditioner, rhs, solution, _parameter.residualNorm, _parameter.maxIterations, _parameter.restart);
+  if (result.breakdown) {
+    PRECICE_WARN("GMRES broke down after {} iterations while solving the linear system of the RBF mapping, as the system matrix is singular. "
+                 "The relative residual is {}. Consider decreasing the compression-tolerance or changing the basis function.",
+                 result.iterations, result.relativeResidual);
+  } else if (result.converged) {
+    PRECICE_DEBUG("The linear system of the RBF mapping converged after {} iterations with relative residual {}", result.iterations, result.relativeResidual);
+  } else {
+    PRECICE_WARN("The linear system of the RBF mapping has not converged after {} iterations. The relative residual is {}. "
+                 "Consider increasing the max-iterations or decreasing the compression-tolerance of the hmatrix executor.",
+                 result.iterations, result.relativeResidual);
+  }
+  return solution;
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+Eigen::VectorXd HMatrixRadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::solveConsistent(const Eigen::VectorXd &inputData, Polynomial polynomial) const
+{
+  PRECICE_ASSERT(inputData.size() == getInputSize(), inputData.size(), getInputSize());
+  Eigen::VectorXd rhs = _inputTree->toTreeOrder(inputData);
+  Eigen::VectorXd out;
+
+  if (polynomial == Polynomial::ON) {
+    Eigen::VectorXd augmented = Eigen::VectorXd::Zero(rhs.size() + _matrixQ.cols());
+    augmented.head(rhs.size()) = rhs;
+    const Eigen::VectorXd coefficients = solveInterpolationSystem(augmented, polynomial);
+    _matrixA->multiply(coefficients.head(rhs.size()), out);
+    out += _matrixV * coefficients.tail(_matrixQ.cols());
+  } else if (polynomial == Polynomial::SEPARATE) {
+    // Solve polynomial QR and subtract it from the input data
+    const Eigen::VectorXd polynomialContribution = _qrMatrixQ.solve(rhs);
+    rhs -= _matrixQ * polynomialContribution;
+    _matrixA->multiply(solveInterpolationSystem(rhs, polynomial), out);
+    out += _matrixV * polynomialContribution;
+  } else {
+    _matrixA->multiply(solveInterpolationSystem(rhs, polynomial), out);
+  }
+  return _outputTree->fromTreeOrder(out);
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+Eigen::VectorXd HMatrixRadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::solveConservative(const Eigen::VectorXd &inputData, Polynomial polynomial) const
+{
+  PRECICE_ASSERT(inputData.size() == getOutputSize(), inputData.size(), getOutputSize());
+  const Eigen::VectorXd in = _outputTree->toTreeOrder(inputData);
+  Eigen::VectorXd       Au;
+  _matrixA->multiplyTransposed(in, Au);
+
+  Eigen::VectorXd out;
+  if (polynomial == Polynomial::ON) {
+    // The saddle point system is symmetric
+    Eigen::VectorXd augmented(Au.size() + _matrixV.cols());
+    augmented << Au, _matrixV.transpose() * in;
+    out = solveInterpolationSystem(augmented, polynomial).head(Au.size());
+  } else {
+    out = solveInterpolationSystem(Au, polynomial);
+    if (polynomial == Polynomial::SEPARATE) {
+      Eigen::VectorXd epsilon = _matrixV.transpose() * in;
+      epsilon -= _matrixQ.transpose() * out;
+      out -= static_cast<Eigen::VectorXd>(_qrMatrixQ.transpose().solve(-epsilon));
+    }
+  }
+  return _inputTree->fromTreeOrder(out);
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+void HMatrixRadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::clear()
+{
+  _matrixC.reset();
+  _matrixA.reset();
+  _inputTree.reset();
+  _outputTree.reset();
+  _diagonalBlocks.clear();
+  _matrixQ   = Eigen::MatrixXd();
+  _matrixV   = Eigen::MatrixXd();
+  _qrMatrixQ = Eigen::ColPivHouseholderQR<Eigen::MatrixXd>();
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+Eigen::Index HMatrixRadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::getInputSize() const
+{
+  return _inputTree ? _inputTree->size() : 0;
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+Eigen::Index HMatrixRadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::getOutputSize() const
+{
+  return _outputTree ? _outputTree->size() : 0;
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+double HMatrixRadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::getCompressionRatio() const
+{
+  PRECICE_ASSERT(_matrixC && _matrixA);
+  const double denseEntries = static_cast<double>(_matrixC->rows()) * _matrixC->cols() + static_cast<double>(_matrixA->rows()) * _matrixA->cols();
+  return denseEntries == 0 ? 1.0 : (_matrixC->storedEntries() + _matrixA->storedEntries()) / denseEntries;
+}
+
+} // namespace mapping
+} // namespace precice
@@ -92,11 +92,8 @@ void NearestNeighborBaseMapping::clear()
   if (requiresGradientData())
     _offsetsMatched.clear();
 
-  if (getConstraint() == CONSISTENT) {
-    input()->index().clear();
-  } else {
-    output()->index().clear();
-  }
+  // The index of the search space is kept, as it may be reused by other mappings.
+  // It is rebuilt automatically once the mesh changes.
 }
 
 void NearestNeighborBaseMapping::onMappingComputed(mesh::PtrMesh origins, mesh::PtrMesh searchSpace)
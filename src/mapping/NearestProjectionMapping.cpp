@@ -82,8 +82,8 @@ void NearestProjectionMapping::computeMapping()
 
   utils::statistics::DistanceAccumulator distanceStatistics;
 
-  _interpolations.clear();
-  _interpolations.reserve(fVertices.size());
+  clear();
+  reserveInterpolations(fVertices.size(), getDimensions());
 
   auto &index = searchSpace->index();
   for (const auto &fVertex : fVertices) {
@@ -91,7 +91,7 @@ void NearestProjectionMapping::computeMapping()
     // Nearest projection element is triangle for 3d if exists, if not the edge and at the worst case it is the nearest vertex
     auto match = index.findNearestProjection(fVertex.getCoords(), nnearest);
     distanceStatistics(match.polation.distance());
-    _interpolations.push_back(std::move(match.polation));
+    addInterpolation(match.polation);
   }
 
   if (distanceStatistics.empty()) {
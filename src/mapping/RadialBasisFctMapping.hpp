@@ -2,11 +2,14 @@
 
 #include <Eigen/Cholesky>
 #include <Eigen/Core>
+#include <tuple>
+#include <type_traits>
 
 #include "com/Communication.hpp"
 #include "com/Extra.hpp"
 #include "config/MappingConfiguration.hpp"
 #include "mapping/RadialBasisFctBaseMapping.hpp"
+#include "mapping/RadialBasisFctSolver.hpp"
 #include "mesh/Filter.hpp"
 #include "precice/impl/Types.hpp"
 #include "profiling/Event.hpp"
@@ -67,6 +70,9 @@ private:
   /// @copydoc RadialBasisFctBaseMapping::mapConsistent
   void mapConsistent(const time::Sample &inData, Eigen::VectorXd &outData) final override;
 
+  /// Reports the performed solves to solvers, which precompute their evaluation operator
+  void countSolves(Eigen::Index solves);
+
   /// Treatment of the polynomial
   Polynomial _polynomial;
 
@@ -178,7 +184,9 @@ void RadialBasisFctMapping<SOLVER_T, Args...>::clear()
 template <typename SOLVER_T, typename... Args>
 std::string RadialBasisFctMapping<SOLVER_T, Args...>::getName() const
 {
-  if constexpr (std::tuple_size_v<std::tuple<Args...>>> 0) {
+  if constexpr (std::is_same_v<std::tuple<Args...>, std::tuple<MappingConfiguration::HMatrixParameter>>) {
+    return "global-iterative RBF (hmatrix-executor)";
+  } else if constexpr (std::tuple_size_v<std::tuple<Args...>>> 0) {
     auto        param = std::get<0>(optionalArgs);
     std::string exec  = param.executor;
     if (param.solver == "qr-solver") {
@@ -191,6 +199,14 @@ std::string RadialBasisFctMapping<SOLVER_T, Args...>::getName() const
   }
 }
 
+template <typename SOLVER_T, typename... Args>
+void RadialBasisFctMapping<SOLVER_T, Args...>::countSolves(Eigen::Index solves)
+{
+  if constexpr (std::is_same_v<SOLVER_T, RadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>>) {
+    _rbfSolver->countSolves(solves);
+  }
+}
+
 template <typename SOLVER_T, typename... Args>
 void RadialBasisFctMapping<SOLVER_T, Args...>::mapConservative(const time::Sample &inData, Eigen::VectorXd &outData)
 {
@@ -271,6 +287,7 @@ void RadialBasisFctMapping<SOLVER_T, Args...>::mapConservative(const time::Sampl
         outputValues[i * valueDim + dim] = out[i];
       }
     }
+    countSolves(valueDim);
 
     // Data scattering to secondary ranks
     if (utils::IntraComm::isPrimary()) {
@@ -392,6 +409,7 @@ void RadialBasisFctMapping<SOLVER_T, Args...>::mapConsistent(const time::Sample
         outputValues[i * valueDim + dim] = out[i];
       }
     }
+    countSolves(valueDim);
 
     outData = Eigen::Map<Eigen::VectorXd>(outputValues.data(), outValuesSize.at(0));
 
@@ -3,15 +3,23 @@
 #include <Eigen/Cholesky>
 #include <Eigen/QR>
 #include <Eigen/SVD>
+#include <Eigen/Sparse>
+#include <Eigen/SparseCholesky>
 #include <boost/range/adaptor/indexed.hpp>
 #include <boost/range/irange.hpp>
+#include <limits>
+#include <memory>
 #include <numeric>
 #include <type_traits>
+#include <vector>
 #include "mapping/MathHelper.hpp"
 #include "mapping/config/MappingConfigurationTypes.hpp"
+#include "math/math.hpp"
+#include "mesh/BoundingBox.hpp"
 #include "mesh/Mesh.hpp"
 #include "precice/impl/Types.hpp"
 #include "profiling/Event.hpp"
+#include "query/Index.hpp"
 
 namespace precice {
 namespace mapping {
@@ -21,12 +29,28 @@ namespace mapping {
  * The class uses a dense matrix decomposition in order to decompose the resulting system(s) and a backward substitution
  * in order to solve the system at runtime. The functionality uses Eigen and supports only serial execution. In case
  * the polynomial="separate" option is used, the polynomial system is solved using a QR decomposition.
+ *
+ * For basis functions with compact support, large systems whose support radius leads to a low fill of the
+ * interpolation matrix are assembled as sparse matrices and decomposed using a sparse LDLT decomposition instead.
+ *
+ * For dense systems, which are applied often, the solver precomputes the evaluation operator A * C^{-1} and
+ * replaces the backward substitution by a single matrix-vector product. As the precomputation costs about as much
+ * as one backward substitution per output vertex, owners report their solves using countSolves(), which precomputes
+ * the operator once the solver has been applied that often.
  */
 template <typename RADIAL_BASIS_FUNCTION_T>
 class RadialBasisFctSolver {
 public:
   using DecompositionType = std::conditional_t<RADIAL_BASIS_FUNCTION_T::isStrictlyPositiveDefinite(), Eigen::LLT<Eigen::MatrixXd>, Eigen::ColPivHouseholderQR<Eigen::MatrixXd>>;
   using BASIS_FUNCTION_T  = RADIAL_BASIS_FUNCTION_T;
+  using SparseDecompositionType = Eigen::SimplicialLDLT<Eigen::SparseMatrix<double>>;
+
+  /// Minimal size of the interpolation matrix to consider the sparse solver
+  static constexpr Eigen::Index sparseMinimalSize = 1000;
+
+  /// Maximal ratio of non-zero entries of the interpolation matrix to use the sparse solver
+  static constexpr double sparseMaximalFill = 0.05;
+
   /// Default constructor
   RadialBasisFctSolver() = default;
 
@@ -36,9 +60,10 @@ public:
    * for consistent mappings and the output mesh for conservative mappings
    * outputMesh refers to the mesh where we evaluate the interpolants, i.e., the output mesh
    * consistent mappings and the input mesh for conservative mappings
+   * The index of the inputMesh is used to find the entries within the support radius of sparse systems.
    */
   template <typename IndexContainer>
-  RadialBasisFctSolver(RADIAL_BASIS_FUNCTION_T basisFunction, const mesh::Mesh &inputMesh, const IndexContainer &inputIDs,
+  RadialBasisFctSolver(RADIAL_BASIS_FUNCTION_T basisFunction, mesh::Mesh &inputMesh, const IndexContainer &inputIDs,
                        const mesh::Mesh &outputMesh, const IndexContainer &outputIDs, std::vector<bool> deadAxis, Polynomial polynomial);
 
   /// Maps the given input data
@@ -56,11 +81,27 @@ public:
   // Returns the size of the input data
   Eigen::Index getOutputSize() const;
 
+  /// Returns true if the system is solved using sparse matrices
+  bool isSparse() const;
+
+  /// Returns true if the evaluation operator A * C^{-1} has been precomputed
+  bool hasPrecomputedOperator() const;
+
+  /// Counts the given number of solves and precomputes the evaluation operator once this pays off
+  void countSolves(Eigen::Index solves);
+
+  /**
+   * Replaces the evaluation matrix A of a dense system by the evaluation operator A * C^{-1} and releases
+   * the decomposition of C. Subsequent solves only need a matrix-vector product with the operator.
+   */
+  void precomputeOperator();
+
 private:
   mutable precice::logging::Logger _log{"mapping::RadialBasisFctSolver"};
 
   double evaluateRippaLOOCVerror(const Eigen::VectorXd &lambda) const;
-  /// Decomposition of the interpolation matrix
+
+  /// Decomposition of the interpolation matrix, released once the evaluation operator is precomputed
   DecompositionType _decMatrixC;
 
   /// Diagonal entris of the inverse matrix C, requires for the Rippa scheme
@@ -75,9 +116,21 @@ private:
   /// Polynomial matrix of the output mesh (for separate polynomial)
   Eigen::MatrixXd _matrixV;
 
-  /// Evaluation matrix (output x input)
+  /// Evaluation matrix (output x input), replaced by the evaluation operator A * C^{-1} once precomputed
   Eigen::MatrixXd _matrixA;
 
+  /// Is _matrixA the precomputed evaluation operator A * C^{-1}?
+  bool _hasPrecomputedOperator = false;
+
+  /// Number of dense solves using the decomposition so far
+  Eigen::Index _denseSolves = 0;
+
+  /// Sparse decomposition of the interpolation matrix, only set for the sparse solver
+  std::shared_ptr<SparseDecompositionType> _sparseDecMatrixC;
+
+  /// Sparse evaluation matrix (output x input), only used by the sparse solver
+  Eigen::SparseMatrix<double> _sparseMatrixA;
+
   bool computeCrossValidation = false;
 };
 
@@ -226,6 +279,82 @@ Eigen::MatrixXd buildMatrixA(RADIAL_BASIS_FUNCTION_T basisFunction, const mesh::
   return matrixA;
 }
 
+/// Estimates the ratio of non-zero entries in the interpolation matrix by sampling rows
+template <typename IndexContainer>
+double estimateInterpolationMatrixFill(double supportRadius, const mesh::Mesh &inputMesh, const IndexContainer &inputIDs, std::array<bool, 3> activeAxis)
+{
+  const Eigen::Index inputSize     = inputIDs.size();
+  const Eigen::Index step          = std::max<Eigen::Index>(1, inputSize / 100);
+  const double       squaredRadius = math::pow_int<2>(supportRadius);
+
+  std::size_t  nonZeros = 0;
+  Eigen::Index samples  = 0;
+  for (Eigen::Index i = 0; i < inputSize; i += step, ++samples) {
+    const auto &u = inputMesh.vertex(*(inputIDs.begin() + i)).rawCoords();
+    for (const auto &j : inputIDs) {
+      nonZeros += computeSquaredDifference(u, inputMesh.vertex(j).rawCoords(), activeAxis) <= squaredRadius;
+    }
+  }
+  return static_cast<double>(nonZeros) / (samples * inputSize);
+}
+
+/**
+ * Assembles the entries of the RBF matrix between the given vertices, skipping entries outside of the support radius
+ *
+ * The columns within the support radius of a row are found using box queries of the index of the column mesh.
+ * Along inactive axes, the boxes span all columns, as distances ignore these axes.
+ */
+template <typename RADIAL_BASIS_FUNCTION_T, typename IndexContainer>
+Eigen::SparseMatrix<double> buildSparseMatrix(RADIAL_BASIS_FUNCTION_T basisFunction, double supportRadius, const mesh::Mesh &rowMesh, const IndexContainer &rowIDs,
+                                              mesh::Mesh &colMesh, const IndexContainer &colIDs, std::array<bool, 3> activeAxis)
+{
+  const double squaredRadius = math::pow_int<2>(supportRadius);
+  const int    dimensions    = colMesh.getDimensions();
+
+  // Gather the column coordinates contiguously and map the vertex IDs of the column mesh to the columns
+  std::vector<mesh::Vertex::RawCoords> colCoords;
+  colCoords.reserve(colIDs.size());
+  std::vector<Eigen::Index> colIndex(colMesh.nVertices(), -1);
+  Eigen::VectorXd           colMin = Eigen::VectorXd::Constant(dimensions, std::numeric_limits<double>::max());
+  Eigen::VectorXd           colMax = Eigen::VectorXd::Constant(dimensions, std::numeric_limits<double>::lowest());
+  for (const auto &j : colIDs | boost::adaptors::indexed()) {
+    const auto &v = colMesh.vertex(j.value());
+    colCoords.push_back(v.rawCoords());
+    colIndex[j.value()] = j.index();
+    colMin              = colMin.cwiseMin(v.getCoords());
+    colMax              = colMax.cwiseMax(v.getCoords());
+  }
+
+  std::vector<Eigen::Triplet<double>> entries;
+  for (const auto &i : rowIDs | boost::adaptors::indexed()) {
+    const auto &u = rowMesh.vertex(i.value()).rawCoords();
+
+    Eigen::VectorXd boxMin = colMin;
+    Eigen::VectorXd boxMax = colMax;
+    for (int d = 0; d < dimensions; ++d) {
+      if (activeAxis[d]) {
+        boxMin[d] = u[d] - supportRadius;
+        boxMax[d] = u[d] + supportRadius;
+      }
+    }
+
+    for (const auto id : colMesh.index().getVerticesInsideBox(mesh::BoundingBox(boxMin, boxMax))) {
+      const Eigen::Index j = colIndex[id];
+      if (j < 0) {
+        continue;
+      }
+      const double squaredDifference = computeSquaredDifference(u, colCoords[j], activeAxis);
+      if (squaredDifference <= squaredRadius) {
+        entries.emplace_back(i.index(), j, basisFunction.evaluate(std::sqrt(squaredDifference)));
+      }
+    }
+  }
+
+  Eigen::SparseMatrix<double> matrix(rowIDs.size(), colIDs.size());
+  matrix.setFromTriplets(entries.begin(), entries.end());
+  return matrix;
+}
+
 // Variant operating on the Cholesky decopmosition
 inline Eigen::VectorXd computeInverseDiagonal(Eigen::LLT<Eigen::MatrixXd> decMatrixC)
 {
@@ -324,7 +453,7 @@ double RadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::evaluateRippaLOOCVerror(co
 
 template <typename RADIAL_BASIS_FUNCTION_T>
 template <typename IndexContainer>
-RadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::RadialBasisFctSolver(RADIAL_BASIS_FUNCTION_T basisFunction, const mesh::Mesh &inputMesh, const IndexContainer &inputIDs,
+RadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::RadialBasisFctSolver(RADIAL_BASIS_FUNCTION_T basisFunction, mesh::Mesh &inputMesh, const IndexContainer &inputIDs,
                                                                     const mesh::Mesh &outputMesh, const IndexContainer &outputIDs, std::vector<bool> deadAxis, Polynomial polynomial)
 {
   PRECICE_ASSERT(!(RADIAL_BASIS_FUNCTION_T::isStrictlyPositiveDefinite() && polynomial == Polynomial::ON), "The integrated polynomial (polynomial=\"on\") is not supported for the selected radial-basis function. Please select another radial-basis function or change the polynomial configuration.");
@@ -332,9 +461,25 @@ RadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::RadialBasisFctSolver(RADIAL_BASIS
   std::array<bool, 3> activeAxis({{false, false, false}});
   std::transform(deadAxis.begin(), deadAxis.end(), activeAxis.begin(), [](const auto ax) { return !ax; });
 
+  // Compactly supported functions on large meshes may lead to sparse systems
+  bool   useSparse     = false;
+  double supportRadius = 0;
+  if constexpr (RADIAL_BASIS_FUNCTION_T::hasCompactSupport()) {
+    supportRadius = basisFunction.getSupportRadius();
+    if (polynomial != Polynomial::ON && static_cast<Eigen::Index>(inputIDs.size()) >= sparseMinimalSize) {
+      const double fill = estimateInterpolationMatrixFill(supportRadius, inputMesh, inputIDs, activeAxis);
+      PRECICE_DEBUG("Estimated fill of the interpolation matrix: {}", fill);
+      useSparse = fill <= sparseMaximalFill;
+    }
+  }
+
   // First, assemble the interpolation matrix and check the invertability
   bool decompositionSuccessful = false;
-  if constexpr (RADIAL_BASIS_FUNCTION_T::isStrictlyPositiveDefinite()) {
+  if (useSparse) {
+    precice::profiling::Event e("map.rbf.assembleSparse");
+    _sparseDecMatrixC = std::make_shared<SparseDecompositionType>(buildSparseMatrix(basisFunction, supportRadius, inputMesh, inputIDs, inputMesh, inputIDs, activeAxis));
+    decompositionSuccessful = _sparseDecMatrixC->info() == Eigen::ComputationInfo::Success;
+  } else if constexpr (RADIAL_BASIS_FUNCTION_T::isStrictlyPositiveDefinite()) {
     _decMatrixC             = buildMatrixCLU(basisFunction, inputMesh, inputIDs, activeAxis, polynomial).llt();
     decompositionSuccessful = _decMatrixC.info() == Eigen::ComputationInfo::Success;
   } else {
@@ -350,13 +495,17 @@ RadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::RadialBasisFctSolver(RADIAL_BASIS
                 inputMesh.getName(), outputMesh.getName());
 
   // For polynomial on, the algorithm might fail in determining the size of the system
-  if (polynomial != Polynomial::ON && computeCrossValidation) {
+  if (polynomial != Polynomial::ON && computeCrossValidation && !useSparse) {
     // TODO: Disable synchronization
     precice::profiling::Event e("map.rbf.computeLOOCV");
     _inverseDiagonal = computeInverseDiagonal(_decMatrixC);
   }
   // Second, assemble evaluation matrix
-  _matrixA = buildMatrixA(basisFunction, inputMesh, inputIDs, outputMesh, outputIDs, activeAxis, polynomial);
+  if (useSparse) {
+    _sparseMatrixA = buildSparseMatrix(basisFunction, supportRadius, outputMesh, outputIDs, inputMesh, inputIDs, activeAxis);
+  } else {
+    _matrixA = buildMatrixA(basisFunction, inputMesh, inputIDs, outputMesh, outputIDs, activeAxis, polynomial);
+  }
 
   // In case we deal with separated polynomials, we need dedicated matrices for the polynomial contribution
   if (polynomial == Polynomial::SEPARATE) {
@@ -400,13 +549,19 @@ Eigen::VectorXd RadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::solveConservative
 {
   PRECICE_ASSERT((_matrixV.size() > 0 && polynomial == Polynomial::SEPARATE) || _matrixV.size() == 0, _matrixV.size());
   // TODO: Avoid temporary allocations
-  // Au is equal to the eta in our PETSc implementation
-  PRECICE_ASSERT(inputData.size() == _matrixA.rows());
-  Eigen::VectorXd Au = _matrixA.transpose() * inputData;
-  PRECICE_ASSERT(Au.size() == _matrixA.cols());
+  PRECICE_ASSERT(inputData.size() == getOutputSize());
 
   // mu in the PETSc implementation
-  Eigen::VectorXd out = _decMatrixC.solve(Au);
+  Eigen::VectorXd out;
+  if (_hasPrecomputedOperator) {
+    // C is symmetric, hence C^{-1} * A^T = (A * C^{-1})^T
+    out = _matrixA.transpose() * inputData;
+  } else {
+    // Au is equal to the eta in our PETSc implementation
+    Eigen::VectorXd Au = isSparse() ? static_cast<Eigen::VectorXd>(_sparseMatrixA.transpose() * inputData) : static_cast<Eigen::VectorXd>(_matrixA.transpose() * inputData);
+    PRECICE_ASSERT(Au.size() == getInputSize());
+    out = isSparse() ? static_cast<Eigen::VectorXd>(_sparseDecMatrixC->solve(Au)) : static_cast<Eigen::VectorXd>(_decMatrixC.solve(Au));
+  }
 
   if (polynomial == Polynomial::SEPARATE) {
     Eigen::VectorXd epsilon = _matrixV.transpose() * inputData;
@@ -434,7 +589,23 @@ Eigen::VectorXd RadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::solveConsistent(E
   }
 
   // Integrated polynomial (and separated)
-  PRECICE_ASSERT(inputData.size() == _matrixA.cols());
+  PRECICE_ASSERT(inputData.size() == getInputSize());
+  if (isSparse()) {
+    Eigen::VectorXd out = _sparseMatrixA * _sparseDecMatrixC->solve(inputData);
+    if (polynomial == Polynomial::SEPARATE) {
+      out += (_matrixV * polynomialContribution);
+    }
+    return out;
+  }
+
+  if (_hasPrecomputedOperator) {
+    Eigen::VectorXd out = _matrixA * inputData;
+    if (polynomial == Polynomial::SEPARATE) {
+      out += (_matrixV * polynomialContribution);
+    }
+    return out;
+  }
+
   Eigen::VectorXd p = _decMatrixC.solve(inputData);
 
   if (polynomial != Polynomial::ON && computeCrossValidation) {
@@ -451,23 +622,66 @@ Eigen::VectorXd RadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::solveConsistent(E
   return out;
 }
 
+template <typename RADIAL_BASIS_FUNCTION_T>
+void RadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::countSolves(Eigen::Index solves)
+{
+  if (isSparse() || _hasPrecomputedOperator) {
+    return;
+  }
+  _denseSolves += solves;
+  // The cross validation requires the coefficients of the interpolant
+  if (!computeCrossValidation && _denseSolves >= _matrixA.rows()) {
+    precomputeOperator();
+  }
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+void RadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::precomputeOperator()
+{
+  PRECICE_ASSERT(!isSparse());
+  PRECICE_ASSERT(!_hasPrecomputedOperator);
+  precice::profiling::Event e("map.rbf.precomputeOperator");
+  PRECICE_DEBUG("Precomputing the evaluation operator of size {}x{} after {} solves", _matrixA.rows(), _matrixA.cols(), _denseSolves);
+  // A * C^{-1} = (C^{-1} * A^T)^T as C is symmetric
+  const Eigen::MatrixXd transposedOperator = _decMatrixC.solve(_matrixA.transpose());
+  _matrixA                                 = transposedOperator.transpose();
+  _decMatrixC                              = DecompositionType();
+  _hasPrecomputedOperator                  = true;
+}
+
 template <typename RADIAL_BASIS_FUNCTION_T>
 void RadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::clear()
 {
   _matrixA    = Eigen::MatrixXd();
   _decMatrixC = DecompositionType();
+  _sparseMatrixA.resize(0, 0);
+  _sparseDecMatrixC.reset();
+  _hasPrecomputedOperator = false;
+  _denseSolves            = 0;
 }
 
 template <typename RADIAL_BASIS_FUNCTION_T>
 Eigen::Index RadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::getInputSize() const
 {
-  return _matrixA.cols();
+  return isSparse() ? _sparseMatrixA.cols() : _matrixA.cols();
 }
 
 template <typename RADIAL_BASIS_FUNCTION_T>
 Eigen::Index RadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::getOutputSize() const
 {
-  return _matrixA.rows();
+  return isSparse() ? _sparseMatrixA.rows() : _matrixA.rows();
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+bool RadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::isSparse() const
+{
+  return _sparseDecMatrixC != nullptr;
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+bool RadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::hasPrecomputedOperator() const
+{
+  return _hasPrecomputedOperator;
 }
 } // namespace mapping
 } // namespace precice
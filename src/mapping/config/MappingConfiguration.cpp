@@ -10,6 +10,7 @@
 #include "logging/LogMacros.hpp"
 #include "mapping/AxialGeoMultiscaleMapping.hpp"
 #include "mapping/GinkgoRadialBasisFctSolver.hpp"
+#include "mapping/HMatrixRadialBasisFctSolver.hpp"
 #include "mapping/LinearCellInterpolationMapping.hpp"
 #include "mapping/Mapping.hpp"
 #include "mapping/NearestNeighborGradientMapping.hpp"
@@ -62,6 +63,7 @@ enum struct RBFBackend {
   Eigen,
   PETSc,
   Ginkgo,
+  HMatrix,
   PUM
 };
 
@@ -93,6 +95,12 @@ struct BackendSelector<RBFBackend::Ginkgo, RBF> {
   typedef mapping::RadialBasisFctMapping<GinkgoRadialBasisFctSolver<RBF>, MappingConfiguration::GinkgoParameter> type;
 };
 #endif
+// Specialization for the hierarchical matrix RBF backend
+template <typename RBF>
+struct BackendSelector<RBFBackend::HMatrix, RBF> {
+  typedef mapping::RadialBasisFctMapping<HMatrixRadialBasisFctSolver<RBF>, MappingConfiguration::HMatrixParameter> type;
+};
+
 // Specialization for the RBF PUM backend
 template <typename RBF>
 struct BackendSelector<RBFBackend::PUM, RBF> {
@@ -281,11 +289,34 @@ MappingConfiguration::MappingConfiguration(
     std::list<XMLTag> ompExecutor{
         XMLTag{*this, EXECUTOR_OMP, once, SUBTAG_EXECUTOR}.setDocumentation("OpenMP executor, which uses Ginkgo with a gather-scatter parallelism.")};
 
+    std::list<XMLTag> hmatrixExecutor{
+        XMLTag{*this, EXECUTOR_HMATRIX, once, SUBTAG_EXECUTOR}.setDocumentation("CPU executor, which compresses the system matrices to hierarchical matrices and uses GMRES with a gather-scatter parallelism. "
+                                                                                "Well-suited for globally supported basis-functions on large meshes. "
+                                                                                "The \"solver-rtol\" of the mapping defines the convergence criterion of GMRES.")};
+
+    const HMatrixParameter defaults;
+
+    auto attrCompressionTolerance = makeXMLAttribute(ATTR_COMPRESSION_TOLERANCE, defaults.compressionTolerance)
+                                        .setDocumentation("Relative tolerance of the adaptive cross approximation, which compresses the well-separated blocks of the system matrices. "
+                                                          "Larger values reduce the memory consumption at the cost of accuracy.");
+    auto attrAdmissibility = makeXMLAttribute(ATTR_ADMISSIBILITY, defaults.admissibility)
+                                 .setDocumentation("Two clusters are compressed if the smaller of their diameters is at most the admissibility times their distance. "
+                                                   "Larger values compress more blocks.");
+    auto attrLeafSize = makeXMLAttribute(ATTR_LEAF_SIZE, defaults.leafSize)
+                            .setDocumentation("Maximum number of vertices of the leaf clusters, which are stored as dense blocks and used for the block-Jacobi preconditioner.");
+    auto attrMaxIterations = makeXMLAttribute(ATTR_MAX_ITERATIONS, defaults.maxIterations)
+                                 .setDocumentation("Maximum number of GMRES iterations over all restarts.");
+    auto attrRestart = makeXMLAttribute(ATTR_RESTART, defaults.restart)
+                           .setDocumentation("Dimension of the Krylov subspace after which GMRES restarts.");
+
+    addAttributes(hmatrixExecutor, {attrCompressionTolerance, attrAdmissibility, attrLeafSize, attrMaxIterations, attrRestart});
+
     addAttributes(deviceExecutors, {attrDeviceId});
     addAttributes(ompExecutor, {attrNThreads});
     addSubtagsToParents(cpuExecutor, rbfIterativeTags);
     addSubtagsToParents(deviceExecutors, rbfIterativeTags);
     addSubtagsToParents(ompExecutor, rbfIterativeTags);
+    addSubtagsToParents(hmatrixExecutor, rbfIterativeTags);
   }
   {
     std::list<XMLTag> cpuExecutor{
@@ -468,6 +499,20 @@ void MappingConfiguration::xmlTagCallback(
       _executorConfig->executor = ExecutorConfiguration::Executor::HIP;
     } else if (tag.getName() == EXECUTOR_OMP) {
       _executorConfig->executor = ExecutorConfiguration::Executor::OpenMP;
+    } else if (tag.getName() == EXECUTOR_HMATRIX) {
+      _executorConfig->executor = ExecutorConfiguration::Executor::HMatrix;
+
+      auto &parameter                = _executorConfig->hmatrixParameter;
+      parameter.compressionTolerance = tag.getDoubleAttributeValue(ATTR_COMPRESSION_TOLERANCE);
+      parameter.admissibility        = tag.getDoubleAttributeValue(ATTR_ADMISSIBILITY);
+      parameter.leafSize             = tag.getIntAttributeValue(ATTR_LEAF_SIZE);
+      parameter.maxIterations        = tag.getIntAttributeValue(ATTR_MAX_ITERATIONS);
+      parameter.restart              = tag.getIntAttributeValue(ATTR_RESTART);
+      PRECICE_CHECK(parameter.compressionTolerance > 0, "The compression-tolerance of the hmatrix executor has to be positive, but is {}.", parameter.compressionTolerance);
+      PRECICE_CHECK(parameter.admissibility > 0, "The admissibility of the hmatrix executor has to be positive, but is {}.", parameter.admissibility);
+      PRECICE_CHECK(parameter.leafSize > 0, "The leaf-size of the hmatrix executor has to be positive, but is {}.", parameter.leafSize);
+      PRECICE_CHECK(parameter.maxIterations > 0, "The max-iterations of the hmatrix executor has to be positive, but is {}.", parameter.maxIterations);
+      PRECICE_CHECK(parameter.restart > 0, "The restart of the hmatrix executor has to be positive, but is {}.", parameter.restart);
     }
 
     _executorConfig->deviceId = tag.getIntAttributeValue(ATTR_DEVICE_ID, -1);
@@ -700,7 +745,13 @@ void MappingConfiguration::finishRBFConfiguration()
     } else {
       PRECICE_UNREACHABLE("Unknown RBF solver.");
     }
-    // 2. any other executor is configured via Ginkgo
+    // 2. the hierarchical matrix executor, which is only available for the iterative solver
+  } else if (_executorConfig->executor == ExecutorConfiguration::Executor::HMatrix) {
+    PRECICE_ASSERT(_rbfConfig.solver == RBFConfiguration::SystemSolver::GlobalIterative);
+    HMatrixParameter hmatrixParameter = _executorConfig->hmatrixParameter;
+    hmatrixParameter.residualNorm     = _rbfConfig.solverRtol;
+    mapping.mapping                   = getRBFMapping<RBFBackend::HMatrix>(_rbfConfig.basisFunction, constraintValue, mapping.fromMesh->getDimensions(), _rbfConfig.supportRadius, _rbfConfig.shapeParameter, _rbfConfig.deadAxis, _rbfConfig.polynomial, hmatrixParameter);
+    // 3. any other executor is configured via Ginkgo
   } else {
 #ifndef PRECICE_NO_GINKGO
     _ginkgoParameter                   = GinkgoParameter();
@@ -49,6 +49,15 @@ public:
     bool         enableUnifiedMemory = false;
   };
 
+  struct HMatrixParameter {
+    double residualNorm         = 1e-8;
+    int    maxIterations        = 1000;
+    double compressionTolerance = 1e-8;
+    double admissibility        = 2.0;
+    int    leafSize             = 64;
+    int    restart              = 200;
+  };
+
   MappingConfiguration(
       xml::XMLTag &              parent,
       mesh::PtrMeshConfiguration meshConfiguration);
@@ -208,6 +217,14 @@ private:
   const std::string EXECUTOR_HIP    = "hip";
   const std::string EXECUTOR_OMP    = "openmp";
 
+  // For iterative RBFs using hierarchical matrices
+  const std::string EXECUTOR_HMATRIX           = "hmatrix";
+  const std::string ATTR_COMPRESSION_TOLERANCE = "compression-tolerance";
+  const std::string ATTR_ADMISSIBILITY         = "admissibility";
+  const std::string ATTR_LEAF_SIZE             = "leaf-size";
+  const std::string ATTR_MAX_ITERATIONS        = "max-iterations";
+  const std::string ATTR_RESTART               = "restart";
+
   const std::string ATTR_DEVICE_ID = "gpu-device-id";
   const std::string ATTR_N_THREADS = "n-threads";
   // const std::string ATTR_ENABLE_UNIFIED_MEMORY = "enable-unified-memory";
@@ -215,7 +232,6 @@ private:
   // const std::string ATTR_USE_PRECONDITIONER    = "use-preconditioner";
   // const std::string ATTR_PRECONDITIONER        = "preconditioner";
   // const std::string ATTR_JACOBI_BLOCK_SIZE     = "jacobi-block-size";
-  // const std::string ATTR_MAX_ITERATIONS        = "max-iterations";
 
   // mapping constraint
   Mapping::Constraint constraintValue{};
@@ -235,12 +251,14 @@ private:
       CPU,
       CUDA,
       HIP,
-      OpenMP
+      OpenMP,
+      HMatrix
     };
 
-    Executor executor = Executor::CPU;
-    int      deviceId{};
-    int      nThreads{};
+    Executor         executor = Executor::CPU;
+    int              deviceId{};
+    int              nThreads{};
+    HMatrixParameter hmatrixParameter{};
   };
 
   std::unique_ptr<ExecutorConfiguration> _executorConfig;
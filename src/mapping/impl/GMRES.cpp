@@ -0,0 +1,100 @@
+#include "mapping/impl/GMRES.hpp"
+
+#include <cmath>
+#include <vector>
+
+#include "utils/assertion.hpp"
+
+namespace precice::mapping::impl {
+
+GMRESResult solveGMRES(const LinearOperator &op, const LinearOperator &preconditioner, const Eigen::VectorXd &b, Eigen::VectorXd &x,
+                       double relativeTolerance, int maxIterations, int restart)
+{
+  PRECICE_ASSERT(restart > 0);
+  PRECICE_ASSERT(x.size() == b.size(), x.size(), b.size());
+
+  GMRESResult  result;
+  const double bNorm = b.norm();
+  if (bNorm == 0.0) {
+    x.setZero();
+    result.converged = true;
+    return result;
+  }
+
+  Eigen::VectorXd residual(b.size()), work(b.size()), preconditioned(b.size());
+  while (true) {
+    op(x, work);
+    residual                = b - work;
+    double beta             = residual.norm();
+    result.relativeResidual = beta / bNorm;
+    if (result.relativeResidual <= relativeTolerance) {
+      result.converged = true;
+      return result;
+    }
+    if (result.iterations >= maxIterations) {
+      return result;
+    }
+
+    // Arnoldi process with modified Gram-Schmidt and Givens rotations
+    const int                    m = std::min(restart, maxIterations - result.iterations);
+    std::vector<Eigen::VectorXd> basis{residual / beta};
+    Eigen::MatrixXd              hessenberg = Eigen::MatrixXd::Zero(m + 1, m);
+    Eigen::VectorXd              cs(m), sn(m), g = Eigen::VectorXd::Zero(m + 1);
+    g(0) = beta;
+
+    int k = 0;
+    while (k < m) {
+      preconditioner(basis[k], preconditioned);
+      op(preconditioned, work);
+      for (int i = 0; i <= k; ++i) {
+        hessenberg(i, k) = basis[i].dot(work);
+        work -= hessenberg(i, k) * basis[i];
+      }
+      hessenberg(k + 1, k) = work.norm();
+
+      for (int i = 0; i < k; ++i) {
+        const double temp    = cs(i) * hessenberg(i, k) + sn(i) * hessenberg(i + 1, k);
+        hessenberg(i + 1, k) = -sn(i) * hessenberg(i, k) + cs(i) * hessenberg(i + 1, k);
+        hessenberg(i, k)     = temp;
+      }
+      const double denominator = std::hypot(hessenberg(k, k), hessenberg(k + 1, k));
+      if (denominator == 0.0) {
+        // The operator maps the new basis vector into the span of the previous ones without a component along it,
+        // such that the Givens rotation and the least-squares problem are undefined
+        result.breakdown = true;
+        break;
+      }
+      cs(k)                    = hessenberg(k, k) / denominator;
+      sn(k)                    = hessenberg(k + 1, k) / denominator;
+      hessenberg(k, k)         = denominator;
+      hessenberg(k + 1, k)     = 0;
+      g(k + 1)                 = -sn(k) * g(k);
+      g(k)                     = cs(k) * g(k);
+
+      const double subdiagonal = work.norm();
+      ++k;
+      ++result.iterations;
+      if (std::abs(g(k)) <= relativeTolerance * bNorm || subdiagonal == 0.0) {
+        break;
+      }
+      basis.push_back(work / subdiagonal);
+    }
+
+    // Solve the upper triangular least-squares problem and update the solution
+    const Eigen::VectorXd y = hessenberg.topLeftCorner(k, k).triangularView<Eigen::Upper>().solve(g.head(k));
+    work.setZero();
+    for (int i = 0; i < k; ++i) {
+      work += y(i) * basis[i];
+    }
+    preconditioner(work, preconditioned);
+    x += preconditioned;
+
+    if (result.breakdown) {
+      op(x, work);
+      result.relativeResidual = (b - work).norm() / bNorm;
+      return result;
+    }
+  }
+}
+
+} // namespace precice::mapping::impl
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <Eigen/Core>
+#include <functional>
+
+namespace precice {
+namespace mapping {
+namespace impl {
+
+/// Applies a linear operator y = op(x)
+using LinearOperator = std::function<void(const Eigen::VectorXd &x, Eigen::VectorXd &y)>;
+
+struct GMRESResult {
+  /// Total amount of iterations over all restarts
+  int iterations = 0;
+
+  /// Final residual norm relative to the norm of the right-hand side
+  double relativeResidual = 0;
+
+  bool converged = false;
+
+  /// The Arnoldi process broke down on a singular operator, x holds the solution up to the breakdown
+  bool breakdown = false;
+};
+
+/**
+ * @brief Solves op(x) = b using the restarted GMRES method with right preconditioning.
+ *
+ * The method does not require a symmetric or definite operator. Right preconditioning
+ * solves op(M^-1 y) = b for y, such that the monitored residual is the residual of the
+ * unpreconditioned system.
+ *
+ * @param[in] op the system operator
+ * @param[in] preconditioner applies the approximate inverse M^-1
+ * @param[in] b the right-hand side
+ * @param[in,out] x the initial guess and the solution
+ * @param[in] relativeTolerance stop once ||b - op(x)|| <= relativeTolerance * ||b||
+ * @param[in] maxIterations maximal amount of iterations over all restarts
+ * @param[in] restart dimension of the Krylov subspace before restarting
+ *
+ * The solver stops early and reports a breakdown, if the operator is singular on the Krylov subspace.
+ */
+GMRESResult solveGMRES(const LinearOperator &op, const LinearOperator &preconditioner, const Eigen::VectorXd &b, Eigen::VectorXd &x,
+                       double relativeTolerance, int maxIterations, int restart = 50);
+
+} // namespace impl
+} // namespace mapping
+} // namespace precice
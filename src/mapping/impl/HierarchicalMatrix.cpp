@@ -0,0 +1,176 @@
+#include "mapping/impl/HierarchicalMatrix.hpp"
+
+#include <algorithm>
+#include <numeric>
+
+#include "utils/assertion.hpp"
+
+namespace precice::mapping::impl {
+
+namespace {
+double diameter(const ClusterTree::Node &node)
+{
+  double sum = 0;
+  for (int d = 0; d < 3; ++d) {
+    const double extent = node.upper[d] - node.lower[d];
+    sum += extent * extent;
+  }
+  return std::sqrt(sum);
+}
+
+double distance(const ClusterTree::Node &a, const ClusterTree::Node &b)
+{
+  double sum = 0;
+  for (int d = 0; d < 3; ++d) {
+    const double gap = std::max({0.0, a.lower[d] - b.upper[d], b.lower[d] - a.upper[d]});
+    sum += gap * gap;
+  }
+  return std::sqrt(sum);
+}
+} // namespace
+
+ClusterTree::ClusterTree(std::vector<Point> points, Eigen::Index leafSize)
+    : _points(std::move(points)), _order(_points.size())
+{
+  PRECICE_ASSERT(leafSize > 0);
+  std::iota(_order.begin(), _order.end(), 0);
+  if (!_points.empty()) {
+    build(0, _points.size(), leafSize);
+
+    // Store the points in tree order
+    std::vector<Point> sorted(_points.size());
+    std::transform(_order.begin(), _order.end(), sorted.begin(), [this](Eigen::Index i) { return _points[i]; });
+    _points = std::move(sorted);
+  }
+}
+
+int ClusterTree::build(Eigen::Index begin, Eigen::Index end, Eigen::Index leafSize)
+{
+  Node node{begin, end, _points[_order[begin]], _points[_order[begin]]};
+  for (auto i = begin; i < end; ++i) {
+    const auto &p = _points[_order[i]];
+    for (int d = 0; d < 3; ++d) {
+      node.lower[d] = std::min(node.lower[d], p[d]);
+      node.upper[d] = std::max(node.upper[d], p[d]);
+    }
+  }
+
+  const int index = _nodes.size();
+  _nodes.push_back(node);
+  if (end - begin <= leafSize) {
+    return index;
+  }
+
+  // Bisect at the median along the longest axis
+  int axis = 0;
+  for (int d = 1; d < 3; ++d) {
+    if (node.upper[d] - node.lower[d] > node.upper[axis] - node.lower[axis]) {
+      axis = d;
+    }
+  }
+  const auto middle = begin + (end - begin) / 2;
+  std::nth_element(_order.begin() + begin, _order.begin() + middle, _order.begin() + end,
+                   [this, axis](Eigen::Index a, Eigen::Index b) { return _points[a][axis] < _points[b][axis]; });
+
+  const int left       = build(begin, middle, leafSize);
+  const int right      = build(middle, end, leafSize);
+  _nodes[index].left  = left;
+  _nodes[index].right = right;
+  return index;
+}
+
+Eigen::VectorXd ClusterTree::toTreeOrder(const Eigen::VectorXd &values) const
+{
+  PRECICE_ASSERT(values.size() == size(), values.size(), size());
+  Eigen::VectorXd result(values.size());
+  for (Eigen::Index i = 0; i < size(); ++i) {
+    result(i) = values(_order[i]);
+  }
+  return result;
+}
+
+Eigen::VectorXd ClusterTree::fromTreeOrder(const Eigen::VectorXd &values) const
+{
+  PRECICE_ASSERT(values.size() == size(), values.size(), size());
+  Eigen::VectorXd result(values.size());
+  for (Eigen::Index i = 0; i < size(); ++i) {
+    result(_order[i]) = values(i);
+  }
+  return result;
+}
+
+std::vector<HierarchicalMatrix::BlockRange> HierarchicalMatrix::partition(const ClusterTree &rows, const ClusterTree &cols, double admissibility)
+{
+  std::vector<BlockRange> blocks;
+  if (rows.size() == 0 || cols.size() == 0) {
+    return blocks;
+  }
+
+  const auto &rowNodes = rows.nodes();
+  const auto &colNodes = cols.nodes();
+
+  std::vector<std::pair<int, int>> stack{{0, 0}};
+  while (!stack.empty()) {
+    const auto [r, c] = stack.back();
+    stack.pop_back();
+    const auto &rowNode = rowNodes[r];
+    const auto &colNode = colNodes[c];
+
+    const double dist       = distance(rowNode, colNode);
+    const bool   admissible = dist > 0 && std::min(diameter(rowNode), diameter(colNode)) <= admissibility * dist;
+    if (admissible || (rowNode.isLeaf() && colNode.isLeaf())) {
+      blocks.push_back({rowNode.begin, rowNode.end, colNode.begin, colNode.end, admissible});
+      continue;
+    }
+
+    // Refine all non-leaf clusters
+    const std::array<int, 2> rowChildren{rowNode.isLeaf() ? r : rowNode.left, rowNode.isLeaf() ? -1 : rowNode.right};
+    const std::array<int, 2> colChildren{colNode.isLeaf() ? c : colNode.left, colNode.isLeaf() ? -1 : colNode.right};
+    for (int rowChild : rowChildren) {
+      for (int colChild : colChildren) {
+        if (rowChild != -1 && colChild != -1) {
+          stack.emplace_back(rowChild, colChild);
+        }
+      }
+    }
+  }
+  return blocks;
+}
+
+void HierarchicalMatrix::multiply(const Eigen::VectorXd &x, Eigen::VectorXd &y) const
+{
+  PRECICE_ASSERT(x.size() == _cols, x.size(), _cols);
+  y.setZero(_rows);
+  for (const auto &block : _denseBlocks) {
+    y.segment(block.rowBegin, block.matrix.rows()).noalias() += block.matrix * x.segment(block.colBegin, block.matrix.cols());
+  }
+  for (const auto &block : _lowRankBlocks) {
+    y.segment(block.rowBegin, block.U.rows()).noalias() += block.U * (block.V.transpose() * x.segment(block.colBegin, block.V.rows()));
+  }
+}
+
+void HierarchicalMatrix::multiplyTransposed(const Eigen::VectorXd &x, Eigen::VectorXd &y) const
+{
+  PRECICE_ASSERT(x.size() == _rows, x.size(), _rows);
+  y.setZero(_cols);
+  for (const auto &block : _denseBlocks) {
+    y.segment(block.colBegin, block.matrix.cols()).noalias() += block.matrix.transpose() * x.segment(block.rowBegin, block.matrix.rows());
+  }
+  for (const auto &block : _lowRankBlocks) {
+    y.segment(block.colBegin, block.V.rows()).noalias() += block.V * (block.U.transpose() * x.segment(block.rowBegin, block.U.rows()));
+  }
+}
+
+std::size_t HierarchicalMatrix::storedEntries() const
+{
+  std::size_t entries = 0;
+  for (const auto &block : _denseBlocks) {
+    entries += block.matrix.size();
+  }
+  for (const auto &block : _lowRankBlocks) {
+    entries += block.U.size() + block.V.size();
+  }
+  return entries;
+}
+
+} // namespace precice::mapping::impl
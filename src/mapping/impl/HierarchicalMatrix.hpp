@@ -0,0 +1,287 @@
+#pragma once
+
+#include <Eigen/Core>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <vector>
+
+#include "mesh/Vertex.hpp"
+
+namespace precice {
+namespace mapping {
+namespace impl {
+
+/**
+ * @brief Binary space partitioning of a point cloud.
+ *
+ * Points are recursively bisected at the median along the longest axis of their
+ * bounding box until a node holds at most leafSize points. The points are stored
+ * in tree order, such that every node covers a contiguous range.
+ */
+class ClusterTree {
+public:
+  using Point = mesh::Vertex::RawCoords;
+
+  struct Node {
+    /// Range of the points in tree order
+    Eigen::Index begin;
+    Eigen::Index end;
+
+    /// Bounding box of the points
+    Point lower;
+    Point upper;
+
+    /// Indices of the child nodes, -1 for leaves
+    int left  = -1;
+    int right = -1;
+
+    Eigen::Index size() const
+    {
+      return end - begin;
+    }
+
+    bool isLeaf() const
+    {
+      return left == -1;
+    }
+  };
+
+  /// Builds the tree from the given points
+  ClusterTree(std::vector<Point> points, Eigen::Index leafSize);
+
+  /// Returns the nodes of the tree, the root node is the first node
+  const std::vector<Node> &nodes() const
+  {
+    return _nodes;
+  }
+
+  /// Returns the points in tree order
+  const std::vector<Point> &points() const
+  {
+    return _points;
+  }
+
+  /// Returns the original index of each point in tree order
+  const std::vector<Eigen::Index> &order() const
+  {
+    return _order;
+  }
+
+  /// Returns the amount of points
+  Eigen::Index size() const
+  {
+    return _points.size();
+  }
+
+  /// Permutes the given vector from original to tree order
+  Eigen::VectorXd toTreeOrder(const Eigen::VectorXd &values) const;
+
+  /// Permutes the given vector from tree to original order
+  Eigen::VectorXd fromTreeOrder(const Eigen::VectorXd &values) const;
+
+private:
+  std::vector<Node>         _nodes;
+  std::vector<Point>        _points;
+  std::vector<Eigen::Index> _order;
+
+  /// Creates the node for the given range and recursively its children
+  int build(Eigen::Index begin, Eigen::Index end, Eigen::Index leafSize);
+};
+
+/**
+ * @brief Hierarchical matrix approximating a kernel matrix between two cluster trees.
+ *
+ * The matrix is partitioned into blocks. Blocks of well-separated clusters are admissible
+ * and approximated by a low-rank factorization U*V^T using adaptive cross approximation
+ * (ACA) with partial pivoting. All other blocks are stored as dense matrices. Storage and
+ * matrix-vector products thus scale with O(N log N) instead of O(N^2) for smooth kernels.
+ *
+ * All vectors passed to the matrix are in tree order of the respective cluster trees.
+ */
+class HierarchicalMatrix {
+public:
+  struct DenseBlock {
+    Eigen::Index    rowBegin;
+    Eigen::Index    colBegin;
+    Eigen::MatrixXd matrix;
+  };
+
+  struct LowRankBlock {
+    Eigen::Index    rowBegin;
+    Eigen::Index    colBegin;
+    Eigen::MatrixXd U;
+    Eigen::MatrixXd V;
+  };
+
+  /**
+   * @brief Assembles the matrix
+   *
+   * @param[in] rows cluster tree of the row points
+   * @param[in] cols cluster tree of the column points
+   * @param[in] kernel callable returning the entry for a row and a column in tree order
+   * @param[in] admissibility parameter eta of the admissibility condition min(diam) <= eta * dist
+   * @param[in] tolerance relative accuracy of the low-rank approximations
+   */
+  template <typename Kernel>
+  HierarchicalMatrix(const ClusterTree &rows, const ClusterTree &cols, Kernel kernel, double admissibility, double tolerance);
+
+  Eigen::Index rows() const
+  {
+    return _rows;
+  }
+
+  Eigen::Index cols() const
+  {
+    return _cols;
+  }
+
+  /// Computes y = H * x
+  void multiply(const Eigen::VectorXd &x, Eigen::VectorXd &y) const;
+
+  /// Computes y = H^T * x
+  void multiplyTransposed(const Eigen::VectorXd &x, Eigen::VectorXd &y) const;
+
+  const std::vector<DenseBlock> &denseBlocks() const
+  {
+    return _denseBlocks;
+  }
+
+  const std::vector<LowRankBlock> &lowRankBlocks() const
+  {
+    return _lowRankBlocks;
+  }
+
+  /// Returns the amount of stored matrix entries, which equals rows() * cols() for a dense matrix
+  std::size_t storedEntries() const;
+
+private:
+  struct BlockRange {
+    Eigen::Index rowBegin;
+    Eigen::Index rowEnd;
+    Eigen::Index colBegin;
+    Eigen::Index colEnd;
+    bool         admissible;
+  };
+
+  Eigen::Index _rows;
+  Eigen::Index _cols;
+
+  std::vector<DenseBlock>   _denseBlocks;
+  std::vector<LowRankBlock> _lowRankBlocks;
+
+  /// Partitions the matrix into admissible and inadmissible blocks
+  static std::vector<BlockRange> partition(const ClusterTree &rows, const ClusterTree &cols, double admissibility);
+
+  /// Approximates the block using ACA, returns false if the approximation does not pay off
+  template <typename Kernel>
+  bool compress(const BlockRange &range, Kernel &kernel, double tolerance);
+};
+
+// --------------------------------------------------------- HEADER IMPLEMENTATIONS
+
+template <typename Kernel>
+HierarchicalMatrix::HierarchicalMatrix(const ClusterTree &rows, const ClusterTree &cols, Kernel kernel, double admissibility, double tolerance)
+    : _rows(rows.size()), _cols(cols.size())
+{
+  for (const auto &range : partition(rows, cols, admissibility)) {
+    if (range.admissible && compress(range, kernel, tolerance)) {
+      continue;
+    }
+    Eigen::MatrixXd matrix(range.rowEnd - range.rowBegin, range.colEnd - range.colBegin);
+    for (Eigen::Index j = 0; j < matrix.cols(); ++j) {
+      for (Eigen::Index i = 0; i < matrix.rows(); ++i) {
+        matrix(i, j) = kernel(range.rowBegin + i, range.colBegin + j);
+      }
+    }
+    _denseBlocks.push_back({range.rowBegin, range.colBegin, std::move(matrix)});
+  }
+}
+
+template <typename Kernel>
+bool HierarchicalMatrix::compress(const BlockRange &range, Kernel &kernel, double tolerance)
+{
+  const Eigen::Index m = range.rowEnd - range.rowBegin;
+  const Eigen::Index n = range.colEnd - range.colBegin;
+  // Storing a rank k approximation is only cheaper than the dense block for k < maxRank
+  const Eigen::Index maxRank = (m * n) / (m + n);
+
+  std::vector<Eigen::VectorXd> us, vs;
+  std::vector<bool>            usedRows(m, false);
+  double                       squaredNorm = 0;
+  Eigen::Index                 pivotRow    = 0;
+
+  while (static_cast<Eigen::Index>(us.size()) < maxRank) {
+    usedRows[pivotRow] = true;
+
+    // Residual of the pivot row
+    Eigen::VectorXd v(n);
+    for (Eigen::Index j = 0; j < n; ++j) {
+      v(j) = kernel(range.rowBegin + pivotRow, range.colBegin + j);
+    }
+    for (std::size_t l = 0; l < us.size(); ++l) {
+      v -= us[l](pivotRow) * vs[l];
+    }
+
+    Eigen::Index pivotCol;
+    const double pivot = v.cwiseAbs().maxCoeff(&pivotCol);
+    if (pivot == 0.0) {
+      // The row is already approximated exactly, try the next unused row
+      const auto next = std::find(usedRows.begin(), usedRows.end(), false);
+      if (next == usedRows.end()) {
+        break;
+      }
+      pivotRow = std::distance(usedRows.begin(), next);
+      continue;
+    }
+    v /= v(pivotCol);
+
+    // Residual of the pivot column
+    Eigen::VectorXd u(m);
+    for (Eigen::Index i = 0; i < m; ++i) {
+      u(i) = kernel(range.rowBegin + i, range.colBegin + pivotCol);
+    }
+    for (std::size_t l = 0; l < us.size(); ++l) {
+      u -= vs[l](pivotCol) * us[l];
+    }
+
+    // Update the Frobenius norm of the approximation
+    const double uNorm = u.squaredNorm();
+    const double vNorm = v.squaredNorm();
+    for (std::size_t l = 0; l < us.size(); ++l) {
+      squaredNorm += 2 * us[l].dot(u) * vs[l].dot(v);
+    }
+    squaredNorm += uNorm * vNorm;
+
+    us.push_back(std::move(u));
+    vs.push_back(std::move(v));
+
+    if (std::sqrt(uNorm * vNorm) <= tolerance * std::sqrt(squaredNorm)) {
+      // Converged
+      LowRankBlock block{range.rowBegin, range.colBegin, Eigen::MatrixXd(m, us.size()), Eigen::MatrixXd(n, vs.size())};
+      for (std::size_t l = 0; l < us.size(); ++l) {
+        block.U.col(l) = us[l];
+        block.V.col(l) = vs[l];
+      }
+      _lowRankBlocks.push_back(std::move(block));
+      return true;
+    }
+
+    // The next pivot row is the largest unused entry of the current column
+    double largest = -1;
+    for (Eigen::Index i = 0; i < m; ++i) {
+      if (!usedRows[i] && std::abs(us.back()(i)) > largest) {
+        largest  = std::abs(us.back()(i));
+        pivotRow = i;
+      }
+    }
+    if (largest < 0) {
+      break;
+    }
+  }
+  return false;
+}
+
+} // namespace impl
+} // namespace mapping
+} // namespace precice
@@ -60,10 +60,10 @@ public:
                          mesh::PtrMesh           outputMesh);
 
   /// Evaluates a conservative mapping and agglomerates the result in the given output data
-  void mapConservative(const time::Sample &inData, Eigen::VectorXd &outData) const;
+  void mapConservative(const time::Sample &inData, Eigen::VectorXd &outData);
 
   /// Evaluates a consistent mapping and agglomerates the result in the given output data
-  void mapConsistent(const time::Sample &inData, Eigen::VectorXd &outData) const;
+  void mapConsistent(const time::Sample &inData, Eigen::VectorXd &outData);
 
   /// Set the normalized weight for the given \p vertexID in the outputMesh
   void setNormalizedWeight(double normalizedWeight, VertexID vertexID);
@@ -188,7 +188,7 @@ void SphericalVertexCluster<RADIAL_BASIS_FUNCTION_T>::setNormalizedWeight(double
 }
 
 template <typename RADIAL_BASIS_FUNCTION_T>
-void SphericalVertexCluster<RADIAL_BASIS_FUNCTION_T>::mapConservative(const time::Sample &inData, Eigen::VectorXd &outData) const
+void SphericalVertexCluster<RADIAL_BASIS_FUNCTION_T>::mapConservative(const time::Sample &inData, Eigen::VectorXd &outData)
 {
   // First, a few sanity checks. Empty partitions shouldn't be stored at all
   PRECICE_ASSERT(!empty());
@@ -225,10 +225,11 @@ void SphericalVertexCluster<RADIAL_BASIS_FUNCTION_T>::mapConservative(const time
       outData[dataIndex * nComponents + c] += result(i);
     }
   }
+  _rbfSolver.countSolves(nComponents);
 }
 
 template <typename RADIAL_BASIS_FUNCTION_T>
-void SphericalVertexCluster<RADIAL_BASIS_FUNCTION_T>::mapConsistent(const time::Sample &inData, Eigen::VectorXd &outData) const
+void SphericalVertexCluster<RADIAL_BASIS_FUNCTION_T>::mapConsistent(const time::Sample &inData, Eigen::VectorXd &outData)
 {
   // First, a few sanity checks. Empty partitions shouldn't be stored at all
   PRECICE_ASSERT(!empty());
@@ -264,6 +265,7 @@ void SphericalVertexCluster<RADIAL_BASIS_FUNCTION_T>::mapConsistent(const time::
       outData[dataIndex * nComponents + c] += result(i) * _normalizedWeights[i];
     }
   }
+  _rbfSolver.countSolves(nComponents);
 }
 
 template <typename RADIAL_BASIS_FUNCTION_T>
@@ -0,0 +1,188 @@
+#include <Eigen/Core>
+#include <random>
+#include <vector>
+
+#include "mapping/HMatrixRadialBasisFctSolver.hpp"
+#include "mapping/RadialBasisFctSolver.hpp"
+#include "mapping/impl/BasisFunctions.hpp"
+#include "mapping/impl/GMRES.hpp"
+#include "mapping/impl/HierarchicalMatrix.hpp"
+#include "mesh/Mesh.hpp"
+#include "testing/TestContext.hpp"
+#include "testing/Testing.hpp"
+
+using namespace precice;
+using namespace precice::mapping;
+
+namespace {
+void fillRandomly(mesh::Mesh &mesh, int nVertices, unsigned seed)
+{
+  std::mt19937                           generator(seed);
+  std::uniform_real_distribution<double> distribution(0.0, 1.0);
+  Eigen::VectorXd                        coords(mesh.getDimensions());
+  for (int i = 0; i < nVertices; ++i) {
+    for (int d = 0; d < mesh.getDimensions(); ++d) {
+      coords[d] = distribution(generator);
+    }
+    mesh.createVertex(coords);
+  }
+}
+
+Eigen::VectorXd sampleFunction(const mesh::Mesh &mesh)
+{
+  Eigen::VectorXd values(mesh.nVertices());
+  for (const auto &v : mesh.vertices()) {
+    values(v.getID()) = std::sin(3 * v.coord(0)) + v.coord(1) * v.coord(1);
+  }
+  return values;
+}
+
+/// Compares the hierarchical solver to the dense solver for all polynomial variants
+template <typename RBF>
+void compareToDenseSolver(RBF function, int dimensions, std::vector<Polynomial> polynomials)
+{
+  mesh::Mesh inMesh("InMesh", dimensions, testing::nextMeshID());
+  mesh::Mesh outMesh("OutMesh", dimensions, testing::nextMeshID());
+  fillRandomly(inMesh, 600, 1);
+  fillRandomly(outMesh, 400, 2);
+
+  const auto inIDs  = boost::irange<Eigen::Index>(0, inMesh.nVertices());
+  const auto outIDs = boost::irange<Eigen::Index>(0, outMesh.nVertices());
+  const auto values = sampleFunction(inMesh);
+
+  MappingConfiguration::HMatrixParameter parameter;
+  parameter.residualNorm         = 1e-9;
+  parameter.compressionTolerance = 1e-10;
+  parameter.leafSize             = 32;
+
+  for (auto polynomial : polynomials) {
+    RadialBasisFctSolver<RBF>        dense(function, inMesh, inIDs, outMesh, outIDs, std::vector<bool>(dimensions, false), polynomial);
+    HMatrixRadialBasisFctSolver<RBF> hmatrix(function, inMesh, inIDs, outMesh, outIDs, std::vector<bool>(dimensions, false), polynomial, parameter);
+    BOOST_TEST(hmatrix.getInputSize() == static_cast<Eigen::Index>(inMesh.nVertices()));
+    BOOST_TEST(hmatrix.getOutputSize() == static_cast<Eigen::Index>(outMesh.nVertices()));
+
+    // The dense solver expects the polynomial entries for polynomial=ON
+    Eigen::VectorXd denseInput     = Eigen::VectorXd::Zero(dense.getInputSize());
+    denseInput.head(values.size()) = values;
+    const Eigen::VectorXd consistent = hmatrix.solveConsistent(values, polynomial);
+    BOOST_TEST(testing::equals(consistent, dense.solveConsistent(denseInput, polynomial), 1e-6));
+
+    // The coefficients of the conservative mapping are sensitive to the conditioning of the system.
+    // Hence, we check that the conservative mapping is the transpose of the consistent mapping.
+    const Eigen::VectorXd outValues    = sampleFunction(outMesh);
+    const Eigen::VectorXd conservative = hmatrix.solveConservative(outValues, polynomial);
+    BOOST_TEST(conservative.size() == values.size());
+    BOOST_TEST(std::abs(conservative.dot(values) - outValues.dot(consistent)) <= 1e-6 * std::abs(outValues.dot(consistent)));
+    if (polynomial != Polynomial::OFF) {
+      BOOST_TEST(testing::equals(conservative.sum(), outValues.sum(), 1e-6));
+    }
+  }
+}
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(MappingTests)
+BOOST_AUTO_TEST_SUITE(HMatrixRadialBasisFunctionSolver)
+
+BOOST_AUTO_TEST_CASE(HierarchicalMatrixProduct)
+{
+  PRECICE_TEST(1_rank);
+  mesh::Mesh rowMesh("Rows", 2, testing::nextMeshID());
+  mesh::Mesh colMesh("Cols", 2, testing::nextMeshID());
+  fillRandomly(rowMesh, 3000, 3);
+  fillRandomly(colMesh, 2000, 4);
+
+  std::vector<mesh::Vertex::RawCoords> rowPoints, colPoints;
+  for (const auto &v : rowMesh.vertices()) {
+    rowPoints.push_back(v.rawCoords());
+  }
+  for (const auto &v : colMesh.vertices()) {
+    colPoints.push_back(v.rawCoords());
+  }
+  const impl::ClusterTree rows(rowPoints, 32);
+  const impl::ClusterTree cols(colPoints, 32);
+
+  ThinPlateSplines fct;
+  auto             kernel = [&](Eigen::Index i, Eigen::Index j) {
+    return fct.evaluate(std::sqrt(computeSquaredDifference(rows.points()[i], cols.points()[j])));
+  };
+  const impl::HierarchicalMatrix matrix(rows, cols, kernel, 2.0, 1e-8);
+  BOOST_TEST(matrix.storedEntries() < 0.5 * rows.size() * cols.size());
+
+  Eigen::MatrixXd dense(rows.size(), cols.size());
+  for (Eigen::Index j = 0; j < dense.cols(); ++j) {
+    for (Eigen::Index i = 0; i < dense.rows(); ++i) {
+      dense(i, j) = kernel(i, j);
+    }
+  }
+
+  const Eigen::VectorXd x = Eigen::VectorXd::Random(cols.size());
+  Eigen::VectorXd       y;
+  matrix.multiply(x, y);
+  BOOST_TEST((y - dense * x).norm() <= 1e-7 * (dense * x).norm());
+
+  const Eigen::VectorXd z = Eigen::VectorXd::Random(rows.size());
+  matrix.multiplyTransposed(z, y);
+  BOOST_TEST((y - dense.transpose() * z).norm() <= 1e-7 * (dense.transpose() * z).norm());
+
+  // Permuting forth and back is the identity
+  BOOST_TEST(testing::equals(rows.fromTreeOrder(rows.toTreeOrder(z)), z));
+}
+
+BOOST_AUTO_TEST_CASE(GMRES)
+{
+  PRECICE_TEST(1_rank);
+  const int       n = 200;
+  Eigen::MatrixXd A = Eigen::MatrixXd::Random(n, n) + 20 * Eigen::MatrixXd::Identity(n, n);
+  Eigen::VectorXd b = Eigen::VectorXd::Random(n);
+
+  impl::LinearOperator op       = [&A](const Eigen::VectorXd &x, Eigen::VectorXd &y) { y = A * x; };
+  impl::LinearOperator identity = [](const Eigen::VectorXd &x, Eigen::VectorXd &y) { y = x; };
+
+  Eigen::VectorXd x      = Eigen::VectorXd::Zero(n);
+  const auto      result = impl::solveGMRES(op, identity, b, x, 1e-10, 500, 20);
+  BOOST_TEST(result.converged);
+  BOOST_TEST(result.iterations > 20);
+  BOOST_TEST((A * x - b).norm() <= 1e-10 * b.norm());
+}
+
+BOOST_AUTO_TEST_CASE(GMRESBreakdown)
+{
+  PRECICE_TEST(1_rank);
+  // A nilpotent operator maps e_1 to e_2 and e_2 to zero, such that the second Givens rotation is undefined
+  Eigen::MatrixXd A(2, 2);
+  A << 0.0, 0.0,
+      1.0, 0.0;
+  const Eigen::VectorXd b = Eigen::VectorXd::Unit(2, 0);
+
+  impl::LinearOperator op       = [&A](const Eigen::VectorXd &x, Eigen::VectorXd &y) { y = A * x; };
+  impl::LinearOperator identity = [](const Eigen::VectorXd &x, Eigen::VectorXd &y) { y = x; };
+
+  Eigen::VectorXd x      = Eigen::VectorXd::Zero(2);
+  const auto      result = impl::solveGMRES(op, identity, b, x, 1e-10, 100, 10);
+  BOOST_TEST(result.breakdown);
+  BOOST_TEST(!result.converged);
+  BOOST_TEST(result.iterations == 1);
+  BOOST_TEST(x.allFinite());
+  BOOST_TEST(result.relativeResidual == 1.0);
+}
+
+BOOST_AUTO_TEST_CASE(ThinPlateSplines2D)
+{
+  PRECICE_TEST(1_rank);
+  compareToDenseSolver(mapping::ThinPlateSplines(), 2, {Polynomial::SEPARATE, Polynomial::ON});
+}
+
+BOOST_AUTO_TEST_CASE(Multiquadrics3D)
+{
+  PRECICE_TEST(1_rank);
+  compareToDenseSolver(mapping::Multiquadrics(0.1), 3, {Polynomial::SEPARATE, Polynomial::ON});
+}
+
+BOOST_AUTO_TEST_CASE(InverseMultiquadrics3D)
+{
+  PRECICE_TEST(1_rank);
+  compareToDenseSolver(mapping::InverseMultiquadrics(0.1), 3, {Polynomial::OFF, Polynomial::SEPARATE});
+}
+
+BOOST_AUTO_TEST_SUITE_END() // HMatrixRadialBasisFunctionSolver
+BOOST_AUTO_TEST_SUITE_END() // MappingTests
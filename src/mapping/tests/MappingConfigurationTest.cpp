@@ -326,5 +326,36 @@ BOOST_AUTO_TEST_CASE(RBFGinkgoOMPConfiguration)
 #endif
 #endif
 
+BOOST_AUTO_TEST_CASE(RBFHMatrixConfiguration)
+{
+  PRECICE_TEST(1_rank);
+
+  std::string pathToTests = testing::getPathToSources() + "/mapping/tests/";
+  std::string file(pathToTests + "mapping-rbf-hmatrix-config.xml");
+  using xml::XMLTag;
+  XMLTag                        tag = xml::getRootTag();
+  mesh::PtrDataConfiguration    dataConfig(new mesh::DataConfiguration(tag));
+  mesh::PtrMeshConfiguration    meshConfig(new mesh::MeshConfiguration(tag, dataConfig));
+  mapping::MappingConfiguration mappingConfig(tag, meshConfig);
+  xml::configure(tag, xml::ConfigurationContext{}, file);
+
+  BOOST_TEST(meshConfig->meshes().size() == 2);
+  BOOST_TEST(mappingConfig.mappings().size() == 1);
+  const auto &configuredMapping = mappingConfig.mappings().at(0);
+  BOOST_TEST(configuredMapping.mapping != nullptr);
+  BOOST_TEST(configuredMapping.mapping->getName() == "global-iterative RBF (hmatrix-executor)");
+  BOOST_TEST(configuredMapping.fromMesh == meshConfig->meshes().at(1));
+  BOOST_TEST(configuredMapping.toMesh == meshConfig->meshes().at(0));
+  BOOST_TEST(configuredMapping.requiresBasisFunction == true);
+  {
+    bool solverSelection = mappingConfig.rbfConfig().solver == MappingConfiguration::RBFConfiguration::SystemSolver::GlobalIterative;
+    BOOST_TEST(solverSelection);
+    bool poly = mappingConfig.rbfConfig().polynomial == Polynomial::SEPARATE;
+    BOOST_TEST(poly);
+    BOOST_TEST(mappingConfig.rbfConfig().deadAxis[2] == true);
+    BOOST_TEST(mappingConfig.rbfConfig().solverRtol == 1e-7);
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 BOOST_AUTO_TEST_SUITE_END()
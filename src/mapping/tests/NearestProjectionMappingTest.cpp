@@ -105,6 +105,49 @@ BOOST_AUTO_TEST_CASE(testConservativeNonIncremental)
   }
 }
 
+BOOST_AUTO_TEST_CASE(VectorData2D)
+{
+  PRECICE_TEST(1_rank);
+  using namespace mesh;
+  int dimensions = 2;
+
+  PtrMesh edgeMesh(new Mesh("EdgeMesh", dimensions, testing::nextMeshID()));
+  Vertex &v1 = edgeMesh->createVertex(Eigen::Vector2d(0.0, 0.0));
+  Vertex &v2 = edgeMesh->createVertex(Eigen::Vector2d(1.0, 1.0));
+  edgeMesh->createEdge(v1, v2);
+
+  PtrMesh pointMesh(new Mesh("PointMesh", dimensions, testing::nextMeshID()));
+  pointMesh->createVertex(Eigen::Vector2d(0.25, 0.25));
+  pointMesh->createVertex(Eigen::Vector2d(1.5, 1.5));
+
+  {
+    mapping::NearestProjectionMapping mapping(mapping::Mapping::CONSISTENT, dimensions);
+    mapping.setMeshes(edgeMesh, pointMesh);
+    mapping.computeMapping();
+
+    Eigen::VectorXd inValues(4);
+    inValues << 1.0, 2.0, 5.0, 10.0;
+    Eigen::VectorXd values = Eigen::VectorXd::Zero(4);
+    mapping.map(time::Sample(2, inValues), values);
+    Eigen::VectorXd expected(4);
+    expected << 2.0, 4.0, 5.0, 10.0;
+    BOOST_TEST(testing::equals(values, expected));
+  }
+  {
+    mapping::NearestProjectionMapping mapping(mapping::Mapping::CONSERVATIVE, dimensions);
+    mapping.setMeshes(pointMesh, edgeMesh);
+    mapping.computeMapping();
+
+    Eigen::VectorXd inValues(4);
+    inValues << 4.0, 8.0, 1.0, 2.0;
+    Eigen::VectorXd values = Eigen::VectorXd::Zero(4);
+    mapping.map(time::Sample(2, inValues), values);
+    Eigen::VectorXd expected(4);
+    expected << 3.0, 6.0, 2.0, 4.0;
+    BOOST_TEST(testing::equals(values, expected));
+  }
+}
+
 BOOST_AUTO_TEST_CASE(ConsistentNonIncremental2D)
 {
   PRECICE_TEST(1_rank);
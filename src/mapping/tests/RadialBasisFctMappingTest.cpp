@@ -1,6 +1,7 @@
 #include <Eigen/Core>
 #include <algorithm>
 #include <memory>
+#include <numeric>
 #include <ostream>
 #include <string>
 #include <utility>
@@ -1557,6 +1558,154 @@ BOOST_AUTO_TEST_CASE(DeadAxis3DConervative)
   testDeadAxis3d(Polynomial::SEPARATE, Mapping::CONSERVATIVE);
 }
 
+BOOST_AUTO_TEST_CASE(SparseCompactSupport)
+{
+  PRECICE_TEST(1_rank);
+  using Eigen::Vector2d;
+  const int dimensions = 2;
+
+  // A regular grid with a small support radius leads to a sparse interpolation matrix
+  mesh::Mesh inMesh("InMesh", dimensions, testing::nextMeshID());
+  mesh::Mesh outMesh("OutMesh", dimensions, testing::nextMeshID());
+  for (int i = 0; i < 40; ++i) {
+    for (int j = 0; j < 40; ++j) {
+      inMesh.createVertex(Vector2d(0.1 * i, 0.1 * j));
+      outMesh.createVertex(Vector2d(0.1 * i + 0.03, 0.1 * j + 0.04));
+    }
+  }
+  Eigen::VectorXd values(inMesh.nVertices());
+  for (const auto &v : inMesh.vertices()) {
+    values(v.getID()) = std::sin(v.coord(0)) + v.coord(1);
+  }
+
+  CompactPolynomialC2 fct(0.25);
+  const auto          inIDs  = boost::irange<Eigen::Index>(0, inMesh.nVertices());
+  const auto          outIDs = boost::irange<Eigen::Index>(0, outMesh.nVertices());
+  for (auto polynomial : {Polynomial::OFF, Polynomial::SEPARATE}) {
+    RadialBasisFctSolver<CompactPolynomialC2> solver(fct, inMesh, inIDs, outMesh, outIDs, {false, false}, polynomial);
+    BOOST_TEST(solver.isSparse());
+    BOOST_TEST(solver.getInputSize() == inMesh.nVertices());
+    BOOST_TEST(solver.getOutputSize() == outMesh.nVertices());
+
+    // Compare against the dense formulation of the same system
+    const std::array<bool, 3> activeAxis{{true, true, false}};
+    const Eigen::MatrixXd     C = buildMatrixCLU(fct, inMesh, inIDs, activeAxis, Polynomial::OFF);
+    const Eigen::MatrixXd     A = buildMatrixA(fct, inMesh, inIDs, outMesh, outIDs, activeAxis, Polynomial::OFF);
+
+    Eigen::VectorXd input = values;
+    if (polynomial == Polynomial::OFF) {
+      const Eigen::VectorXd expected = A * C.llt().solve(values);
+      BOOST_TEST(testing::equals(solver.solveConsistent(input, polynomial), expected, 1e-9));
+    } else {
+      // The polynomial is exactly reproduced
+      Eigen::VectorXd linear(inMesh.nVertices());
+      Eigen::VectorXd expected(outMesh.nVertices());
+      for (const auto &v : inMesh.vertices()) {
+        linear(v.getID()) = 2 * v.coord(0) - v.coord(1) + 1;
+      }
+      for (const auto &v : outMesh.vertices()) {
+        expected(v.getID()) = 2 * v.coord(0) - v.coord(1) + 1;
+      }
+      BOOST_TEST(testing::equals(solver.solveConsistent(linear, polynomial), expected, 1e-9));
+    }
+
+    const Eigen::VectorXd outValues = Eigen::VectorXd::Ones(outMesh.nVertices());
+    if (polynomial == Polynomial::OFF) {
+      const Eigen::VectorXd expected = C.llt().solve(A.transpose() * outValues);
+      BOOST_TEST(testing::equals(solver.solveConservative(outValues, polynomial), expected, 1e-9));
+    } else {
+      // The constant part is conserved
+      BOOST_TEST(testing::equals(solver.solveConservative(outValues, polynomial).sum(), outValues.sum(), 1e-9));
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(SparseMatrixAssembly)
+{
+  PRECICE_TEST(1_rank);
+  using Eigen::Vector2d;
+  const int dimensions = 2;
+
+  mesh::Mesh rowMesh("RowMesh", dimensions, testing::nextMeshID());
+  mesh::Mesh colMesh("ColMesh", dimensions, testing::nextMeshID());
+  for (int i = 0; i < 20; ++i) {
+    for (int j = 0; j < 20; ++j) {
+      rowMesh.createVertex(Vector2d(0.1 * i + 0.03, 0.1 * j + 0.04));
+      colMesh.createVertex(Vector2d(0.1 * i, 0.1 * j));
+    }
+  }
+
+  // Only a subset of the column mesh forms the columns of the matrix
+  std::vector<VertexID> rowIDs(rowMesh.nVertices());
+  std::iota(rowIDs.begin(), rowIDs.end(), 0);
+  std::vector<VertexID> colIDs;
+  for (VertexID id = 0; id < static_cast<VertexID>(colMesh.nVertices()); id += 3) {
+    colIDs.push_back(id);
+  }
+
+  // The entries outside of the support radius vanish in the dense matrix, also if an axis is inactive
+  CompactPolynomialC2 fct(0.25);
+  for (auto activeAxis : {std::array<bool, 3>{{true, true, false}}, std::array<bool, 3>{{true, false, false}}}) {
+    const Eigen::MatrixXd sparse = buildSparseMatrix(fct, fct.getSupportRadius(), rowMesh, rowIDs, colMesh, colIDs, activeAxis);
+    const Eigen::MatrixXd dense  = buildMatrixA(fct, colMesh, colIDs, rowMesh, rowIDs, activeAxis, Polynomial::OFF);
+    BOOST_TEST(testing::equals(sparse, dense));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(PrecomputedOperator)
+{
+  PRECICE_TEST(1_rank);
+  using Eigen::Vector2d;
+  const int dimensions = 2;
+
+  mesh::Mesh inMesh("InMesh", dimensions, testing::nextMeshID());
+  mesh::Mesh outMesh("OutMesh", dimensions, testing::nextMeshID());
+  for (int i = 0; i < 10; ++i) {
+    for (int j = 0; j < 10; ++j) {
+      inMesh.createVertex(Vector2d(0.1 * i, 0.1 * j));
+    }
+  }
+  for (int i = 0; i < 5; ++i) {
+    outMesh.createVertex(Vector2d(0.17 * i + 0.01, 0.13 * i + 0.02));
+  }
+  const auto inIDs  = boost::irange<Eigen::Index>(0, inMesh.nVertices());
+  const auto outIDs = boost::irange<Eigen::Index>(0, outMesh.nVertices());
+
+  Eigen::VectorXd values(inMesh.nVertices());
+  for (const auto &v : inMesh.vertices()) {
+    values(v.getID()) = std::sin(v.coord(0)) + v.coord(1);
+  }
+  const Eigen::VectorXd outValues = Eigen::VectorXd::LinSpaced(outMesh.nVertices(), 1.0, 2.0);
+
+  // Small entries of the results are dominated by round-off errors, hence we compare the norm of the difference
+  auto isClose = [](const Eigen::VectorXd &result, const Eigen::VectorXd &reference) {
+    return (result - reference).norm() <= 1e-9 * reference.norm();
+  };
+
+  for (auto polynomial : {Polynomial::OFF, Polynomial::SEPARATE, Polynomial::ON}) {
+    RadialBasisFctSolver<ThinPlateSplines> solver(ThinPlateSplines(), inMesh, inIDs, outMesh, outIDs, {false, false}, polynomial);
+    BOOST_TEST(!solver.hasPrecomputedOperator());
+
+    // The integrated polynomial expects additional zero entries
+    Eigen::VectorXd input     = Eigen::VectorXd::Zero(solver.getInputSize());
+    input.head(values.size()) = values;
+
+    Eigen::VectorXd       copy                  = input;
+    const Eigen::VectorXd referenceConsistent   = solver.solveConsistent(copy, polynomial);
+    const Eigen::VectorXd referenceConservative = solver.solveConservative(outValues, polynomial);
+
+    // The operator is precomputed once the reported solves reach the number of output vertices
+    solver.countSolves(outMesh.nVertices() - 1);
+    BOOST_TEST(!solver.hasPrecomputedOperator());
+    solver.countSolves(1);
+    BOOST_TEST(solver.hasPrecomputedOperator());
+
+    copy = input;
+    BOOST_TEST(isClose(solver.solveConsistent(copy, polynomial), referenceConsistent));
+    BOOST_TEST(isClose(solver.solveConservative(outValues, polynomial), referenceConservative));
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END() // Serial
 
 BOOST_AUTO_TEST_SUITE(Helper)
@@ -85,6 +85,12 @@ void Data::setSampleAtTime(double time, const time::Sample &sample)
   _waveform.timeStepsStorage().setSampleAtTime(time, sample);
 }
 
+void Data::setSampleAtTime(double time, time::Sample &&sample)
+{
+  _sample = sample; // @todo at some point we should not need this anymore, when mapping, acceleration ... directly work on _timeStepsStorage
+  _waveform.timeStepsStorage().setSampleAtTime(time, std::move(sample));
+}
+
 const std::string &Data::getName() const
 {
   return _name;
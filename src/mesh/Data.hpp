@@ -105,6 +105,9 @@ public:
   /// Add sample at given time to _timeStepsStorage.
   void setSampleAtTime(double time, const time::Sample &sample);
 
+  /// Add sample at given time to _timeStepsStorage, moving its values into the storage.
+  void setSampleAtTime(double time, time::Sample &&sample);
+
   /// Returns the name of the data set, as set in the config file.
   const std::string &getName() const;
 
@@ -3,10 +3,14 @@
 #include <algorithm>
 #include <array>
 #include <boost/container/flat_map.hpp>
+#include <boost/container_hash/hash.hpp>
+#include <cstdint>
 #include <functional>
 #include <memory>
+#include <numeric>
 #include <ostream>
 #include <type_traits>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -19,6 +23,7 @@
 #include "mesh/Data.hpp"
 #include "mesh/Vertex.hpp"
 #include "precice/impl/Types.hpp"
+#include "profiling/Event.hpp"
 #include "query/Index.hpp"
 #include "utils/assertion.hpp"
 
@@ -104,6 +109,7 @@ Vertex &Mesh::createVertex(const Eigen::Ref<const Eigen::VectorXd> &coords)
 {
   PRECICE_ASSERT(coords.size() == _dimensions, coords.size(), _dimensions);
   auto nextID = _vertices.size();
+  ++_revision;
   _vertices.emplace_back(coords, nextID);
   return _vertices.back();
 }
@@ -112,6 +118,7 @@ Edge &Mesh::createEdge(
     Vertex &vertexOne,
     Vertex &vertexTwo)
 {
+  ++_revision;
   _edges.emplace_back(vertexOne, vertexTwo);
   return _edges.back();
 }
@@ -125,6 +132,7 @@ Triangle &Mesh::createTriangle(
       edgeOne.connectedTo(edgeTwo) &&
       edgeTwo.connectedTo(edgeThree) &&
       edgeThree.connectedTo(edgeOne));
+  ++_revision;
   _triangles.emplace_back(edgeOne, edgeTwo, edgeThree);
   return _triangles.back();
 }
@@ -134,6 +142,7 @@ Triangle &Mesh::createTriangle(
     Vertex &vertexTwo,
     Vertex &vertexThree)
 {
+  ++_revision;
   _triangles.emplace_back(vertexOne, vertexTwo, vertexThree);
   return _triangles.back();
 }
@@ -144,10 +153,49 @@ Tetrahedron &Mesh::createTetrahedron(
     Vertex &vertexThree,
     Vertex &vertexFour)
 {
+  ++_revision;
   _tetrahedra.emplace_back(vertexOne, vertexTwo, vertexThree, vertexFour);
   return _tetrahedra.back();
 }
 
+VertexID Mesh::createVertices(const Eigen::Ref<const Eigen::MatrixXd> &coords)
+{
+  PRECICE_ASSERT(coords.rows() == _dimensions, coords.rows(), _dimensions);
+  const VertexID firstID = _vertices.size();
+  ++_revision;
+  for (Eigen::Index i = 0; i < coords.cols(); ++i) {
+    _vertices.emplace_back(coords.col(i), firstID + i);
+  }
+  return firstID;
+}
+
+void Mesh::createEdges(precice::span<const VertexID> vertexIDs)
+{
+  PRECICE_ASSERT(vertexIDs.size() % 2 == 0, vertexIDs.size());
+  ++_revision;
+  for (std::size_t i = 0; i < vertexIDs.size(); i += 2) {
+    _edges.emplace_back(_vertices[vertexIDs[i]], _vertices[vertexIDs[i + 1]]);
+  }
+}
+
+void Mesh::createTriangles(precice::span<const VertexID> vertexIDs)
+{
+  PRECICE_ASSERT(vertexIDs.size() % 3 == 0, vertexIDs.size());
+  ++_revision;
+  for (std::size_t i = 0; i < vertexIDs.size(); i += 3) {
+    _triangles.emplace_back(_vertices[vertexIDs[i]], _vertices[vertexIDs[i + 1]], _vertices[vertexIDs[i + 2]]);
+  }
+}
+
+void Mesh::createTetrahedra(precice::span<const VertexID> vertexIDs)
+{
+  PRECICE_ASSERT(vertexIDs.size() % 4 == 0, vertexIDs.size());
+  ++_revision;
+  for (std::size_t i = 0; i < vertexIDs.size(); i += 4) {
+    _tetrahedra.emplace_back(_vertices[vertexIDs[i]], _vertices[vertexIDs[i + 1]], _vertices[vertexIDs[i + 2]], _vertices[vertexIDs[i + 3]]);
+  }
+}
+
 PtrData &Mesh::createData(
     const std::string &name,
     int                dimension,
@@ -260,6 +308,7 @@ void Mesh::clear()
   _vertices.clear();
   _tetrahedra.clear();
   _index.clear();
+  ++_revision;
 
   for (mesh::PtrData &data : _data) {
     data->values().resize(0);
@@ -387,29 +436,99 @@ void Mesh::expandBoundingBox(const BoundingBox &boundingBox)
 
 void Mesh::preprocess()
 {
-  removeDuplicates();
+  {
+    profiling::Event e("mesh.removeDuplicates." + _name);
+    removeDuplicates();
+  }
+  profiling::Event e("mesh.generateImplicitPrimitives." + _name);
   generateImplictPrimitives();
 }
 
+namespace {
+
+/** Returns the permutation, which sorts the primitives by their operator<.
+ *
+ * The vertex IDs of all primitives are gathered into a flat array first.
+ * A stable LSD radix sort then orders by the vertex IDs from the last to the first vertex of the primitives.
+ * This is equivalent to comparing the tuples of vertex IDs, but avoids dereferencing vertices during sorting.
+ */
+template <class Container>
+std::vector<std::size_t> radixSortedOrder(const Container &primitives)
+{
+  constexpr int     nVertices = Container::value_type::vertexCount;
+  const std::size_t size      = primitives.size();
+
+  std::vector<std::uint32_t> ids(size * nVertices);
+  std::uint32_t              maxID = 0;
+  for (std::size_t i = 0; i < size; ++i) {
+    for (int j = 0; j < nVertices; ++j) {
+      const auto id          = static_cast<std::uint32_t>(primitives[i].vertex(j).getID());
+      ids[i * nVertices + j] = id;
+      maxID                  = std::max(maxID, id);
+    }
+  }
+
+  // Only sort by the significant bits of the IDs, using digits of at most 16 bits
+  int bits = 1;
+  while (bits < 32 && (maxID >> bits) != 0) {
+    ++bits;
+  }
+  const int           digitBits = std::min(bits, 16);
+  const std::uint32_t mask      = (std::uint32_t{1} << digitBits) - 1;
+
+  std::vector<std::size_t> order(size), buffer(size), offsets;
+  std::iota(order.begin(), order.end(), 0);
+  for (int vertex = nVertices - 1; vertex >= 0; --vertex) {
+    for (int shift = 0; shift < bits; shift += digitBits) {
+      auto digit = [&](std::size_t i) { return (ids[i * nVertices + vertex] >> shift) & mask; };
+      offsets.assign(mask + 2, 0);
+      for (auto i : order) {
+        ++offsets[digit(i) + 1];
+      }
+      std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+      for (auto i : order) {
+        buffer[offsets[digit(i)]++] = i;
+      }
+      order.swap(buffer);
+    }
+  }
+  return order;
+}
+
+/** Sorts the primitives and removes adjacent duplicates
+ *
+ * This results in the same container as std::sort followed by std::unique.
+ */
+template <class Container>
+Container sortedUniquePrimitives(const Container &primitives)
+{
+  Container unique;
+  for (auto i : radixSortedOrder(primitives)) {
+    if (unique.empty() || !(unique.back() == primitives[i])) {
+      unique.push_back(primitives[i]);
+    }
+  }
+  return unique;
+}
+
+} // namespace
+
 void Mesh::removeDuplicates()
 {
+  // Sorting reorders primitives, which invalidates their indices
+  ++_revision;
+
   // Remove duplicate tetrahedra
   auto tetrahedraCnt = _tetrahedra.size();
-  std::sort(_tetrahedra.begin(), _tetrahedra.end());
-  auto lastTetrahedron = std::unique(_tetrahedra.begin(), _tetrahedra.end());
-  _tetrahedra          = TetraContainer{_tetrahedra.begin(), lastTetrahedron};
+  _tetrahedra        = sortedUniquePrimitives(_tetrahedra);
 
   // Remove duplicate triangles
   auto triangleCnt = _triangles.size();
-  std::sort(_triangles.begin(), _triangles.end());
-  auto lastTriangle = std::unique(_triangles.begin(), _triangles.end());
-  _triangles        = TriangleContainer{_triangles.begin(), lastTriangle};
+  _triangles       = sortedUniquePrimitives(_triangles);
 
   // Remove duplicate edges
   auto edgeCnt = _edges.size();
-  std::sort(_edges.begin(), _edges.end());
-  auto lastEdge = std::unique(_edges.begin(), _edges.end());
-  _edges        = EdgeContainer{_edges.begin(), lastEdge};
+  _edges       = sortedUniquePrimitives(_edges);
 
   PRECICE_DEBUG("Compression removed {} tetrahedra ({} to {}), {} triangles ({} to {}), and {} edges ({} to {})",
                 tetrahedraCnt - _tetrahedra.size(), tetrahedraCnt, _tetrahedra.size(),
@@ -440,6 +559,26 @@ auto sortedVertexPtrsFor(Primitive &p)
 {
   return sortedVertexPtrsForImpl(p, std::make_integer_sequence<int, Primitive::vertexCount>{});
 }
+
+/// Key of a primitive, which contains the IDs of the vertices in the order of sortedVertexPtrsFor()
+template <std::size_t N>
+using VertexIDsKey = std::array<VertexID, N>;
+
+template <std::size_t N>
+struct VertexIDsHash {
+  std::size_t operator()(const VertexIDsKey<N> &key) const
+  {
+    std::size_t seed = 0;
+    for (auto id : key) {
+      boost::hash_combine(seed, id);
+    }
+    return seed;
+  }
+};
+
+template <std::size_t N>
+using VertexIDsSet = std::unordered_set<VertexIDsKey<N>, VertexIDsHash<N>>;
+
 } // namespace
 
 void Mesh::generateImplictPrimitives()
@@ -456,17 +595,17 @@ void Mesh::generateImplictPrimitives()
   // First handle all explicit tetrahedra
 
   // Build a set of all explicit triangles
-  using ExisitingTriangle = std::tuple<Vertex *, Vertex *, Vertex *>;
-  std::set<ExisitingTriangle> triangles;
+  VertexIDsSet<3> triangles;
+  triangles.reserve(_triangles.size() + 4 * _tetrahedra.size());
   for (auto &t : _triangles) {
-    triangles.insert(sortedVertexPtrsFor(t));
+    auto [a, b, c] = sortedVertexPtrsFor(t);
+    triangles.insert({a->getID(), b->getID(), c->getID()});
   }
 
   // Generate all missing implicit triangles of explicit tetrahedra
   // Update the triangles set used by the implicit edge generation
   auto createTriangleIfMissing = [&](Vertex *a, Vertex *b, Vertex *c) {
-    if (triangles.count({a, b, c}) == 0) {
-      triangles.emplace(a, b, c);
+    if (triangles.insert({a->getID(), b->getID(), c->getID()}).second) {
       createTriangle(*a, *b, *c);
     };
   };
@@ -481,16 +620,16 @@ void Mesh::generateImplictPrimitives()
 
   // Second handle all triangles, both explicit and implicit from the tetrahedron phase
   // Build an set of all explicit triangles
-  using ExisitingEdge = std::tuple<Vertex *, Vertex *>;
-  std::set<ExisitingEdge> edges;
+  VertexIDsSet<2> edges;
+  edges.reserve(_edges.size() + 3 * _triangles.size());
   for (auto &e : _edges) {
-    edges.emplace(sortedVertexPtrsFor(e));
+    auto [a, b] = sortedVertexPtrsFor(e);
+    edges.insert({a->getID(), b->getID()});
   }
 
   // generate all missing implicit edges of implicit and explicit triangles
   auto createEdgeIfMissing = [&](Vertex *a, Vertex *b) {
-    if (edges.count({a, b}) == 0) {
-      edges.emplace(a, b);
+    if (edges.insert({a->getID(), b->getID()}).second) {
       createEdge(*a, *b);
     };
   };
@@ -18,6 +18,7 @@
 #include "mesh/Triangle.hpp"
 #include "mesh/Vertex.hpp"
 #include "precice/impl/Types.hpp"
+#include "precice/span.hpp"
 #include "query/Index.hpp"
 #include "utils/ManageUniqueIDs.hpp"
 #include "utils/assertion.hpp"
@@ -181,6 +182,26 @@ public:
       Vertex &vertexThree,
       Vertex &vertexFour);
 
+  ///@name Bulk creation
+  ///@{
+
+  /**
+   * @brief Creates a vertex for every column of the given coordinates.
+   *
+   * @returns the ID of the first created vertex, the IDs of the others follow consecutively.
+   */
+  VertexID createVertices(const Eigen::Ref<const Eigen::MatrixXd> &coords);
+
+  /**
+   * @brief Creates edges, triangles, or tetrahedra from a flat list of vertex IDs.
+   *
+   * Every primitive is defined by 2, 3, or 4 consecutive IDs, which have to be valid.
+   */
+  void createEdges(precice::span<const VertexID> vertexIDs);
+  void createTriangles(precice::span<const VertexID> vertexIDs);
+  void createTetrahedra(precice::span<const VertexID> vertexIDs);
+  ///@}
+
   /// Create only data for vertex
   PtrData &createData(const std::string &name,
                       int                dimension,
@@ -214,6 +235,18 @@ public:
   /// Returns true if the given vertexID is valid
   bool isValidVertexID(VertexID vertexID) const;
 
+  /**
+   * @brief Returns the revision of the mesh primitives.
+   *
+   * The revision changes whenever primitives are created, removed or the mesh is cleared.
+   * It is used to detect outdated cached data such as the index trees.
+   * Note that changing coordinates of existing vertices doesn't change the revision.
+   */
+  std::size_t getRevision() const
+  {
+    return _revision;
+  }
+
   /// Allocates memory for the vertex data values and corresponding gradient values.
   void allocateDataValues(); //@todo Redesign mapping and remove this function. See https://github.com/precice/precice/issues/1651.
 
@@ -392,6 +425,9 @@ private:
 
   BoundingBox _boundingBox;
 
+  /// Revision of the mesh primitives, @see getRevision()
+  std::size_t _revision = 0;
+
   query::Index _index;
 
   /// Removes all duplicate connectivity.
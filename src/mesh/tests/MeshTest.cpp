@@ -1,8 +1,11 @@
 #include <Eigen/Core>
 #include <algorithm>
+#include <array>
 #include <deque>
 #include <iosfwd>
 #include <memory>
+#include <random>
+#include <set>
 #include <string>
 #include <vector>
 
@@ -298,6 +301,41 @@ BOOST_AUTO_TEST_CASE(ResizeDataShrink)
   BOOST_TEST(values.size() == 2);
 }
 
+BOOST_AUTO_TEST_CASE(BulkCreation)
+{
+  PRECICE_TEST(1_rank);
+  precice::mesh::Mesh mesh("MyMesh", 3, testing::nextMeshID());
+  mesh.createVertex(Vector3d(0.0, 0.0, 0.0));
+
+  Eigen::MatrixXd coords(3, 4);
+  coords << 1.0, 0.0, 0.0, 1.0,
+      0.0, 1.0, 0.0, 1.0,
+      0.0, 0.0, 1.0, 1.0;
+  const VertexID first = mesh.createVertices(coords);
+  BOOST_TEST(first == 1);
+  BOOST_TEST_REQUIRE(mesh.nVertices() == 5);
+  for (int i = 0; i < 4; ++i) {
+    BOOST_TEST(mesh.vertex(first + i).getID() == first + i);
+    BOOST_TEST(testing::equals(mesh.vertex(first + i).getCoords(), Eigen::VectorXd(coords.col(i))));
+  }
+
+  const std::vector<VertexID> edges{0, 1, 1, 2};
+  mesh.createEdges(edges);
+  BOOST_TEST_REQUIRE(mesh.edges().size() == 2);
+  BOOST_TEST(&mesh.edges()[1].vertex(0) == &mesh.vertex(1));
+  BOOST_TEST(&mesh.edges()[1].vertex(1) == &mesh.vertex(2));
+
+  const std::vector<VertexID> triangles{0, 1, 2, 1, 2, 3};
+  mesh.createTriangles(triangles);
+  BOOST_TEST_REQUIRE(mesh.triangles().size() == 2);
+  BOOST_TEST(&mesh.triangles()[1].vertex(2) == &mesh.vertex(3));
+
+  const std::vector<VertexID> tetrahedra{0, 1, 2, 3, 1, 2, 3, 4};
+  mesh.createTetrahedra(tetrahedra);
+  BOOST_TEST_REQUIRE(mesh.tetrahedra().size() == 2);
+  BOOST_TEST(&mesh.tetrahedra()[1].vertex(3) == &mesh.vertex(4));
+}
+
 BOOST_AUTO_TEST_SUITE(Utils)
 
 BOOST_AUTO_TEST_CASE(AsChain)
@@ -1090,6 +1128,92 @@ BOOST_AUTO_TEST_CASE(Complex)
   }
 }
 
+BOOST_AUTO_TEST_CASE(MatchesSortAndUnique)
+{
+  PRECICE_TEST(1_rank);
+  Mesh mesh{"Mesh1", 3, 0};
+
+  // More than 2^16 vertices require multiple radix passes per vertex
+  const int nVertices = 70000;
+  for (int i = 0; i < nVertices; ++i) {
+    mesh.createVertex(Eigen::Vector3d(i % 100, (i / 100) % 100, i / 10000));
+  }
+
+  std::mt19937                       generator(42);
+  std::uniform_int_distribution<int> distribution(0, nVertices - 1);
+  auto                               vertices = [&](auto count) {
+    std::set<int> ids;
+    while (static_cast<int>(ids.size()) < count) {
+      ids.insert(distribution(generator));
+    }
+    std::vector<Vertex *> result;
+    for (auto id : ids) {
+      result.push_back(&mesh.vertex(id));
+    }
+    std::shuffle(result.begin(), result.end(), generator);
+    return result;
+  };
+
+  for (int i = 0; i < 500; ++i) {
+    auto v = vertices(4);
+    mesh.createTetrahedron(*v[0], *v[1], *v[2], *v[3]);
+    auto t = vertices(3);
+    mesh.createTriangle(*t[0], *t[1], *t[2]);
+    auto e = vertices(2);
+    mesh.createEdge(*e[0], *e[1]);
+  }
+  // Duplicates
+  for (int i = 0; i < 100; ++i) {
+    mesh.tetrahedra().push_back(mesh.tetrahedra()[i]);
+    mesh.triangles().push_back(mesh.triangles()[2 * i]);
+    mesh.edges().push_back(mesh.edges()[3 * i]);
+  }
+
+  auto expectedTetrahedra = mesh.tetrahedra();
+  std::sort(expectedTetrahedra.begin(), expectedTetrahedra.end());
+  expectedTetrahedra.erase(std::unique(expectedTetrahedra.begin(), expectedTetrahedra.end()), expectedTetrahedra.end());
+  auto expectedTriangles = mesh.triangles();
+  std::sort(expectedTriangles.begin(), expectedTriangles.end());
+  expectedTriangles.erase(std::unique(expectedTriangles.begin(), expectedTriangles.end()), expectedTriangles.end());
+
+  mesh.preprocess();
+
+  BOOST_TEST_REQUIRE(mesh.tetrahedra().size() == expectedTetrahedra.size());
+  for (std::size_t i = 0; i < expectedTetrahedra.size(); ++i) {
+    for (int v = 0; v < 4; ++v) {
+      BOOST_TEST(&mesh.tetrahedra()[i].vertex(v) == &expectedTetrahedra[i].vertex(v));
+    }
+  }
+
+  // Implicit triangles are appended to the sorted explicit triangles
+  BOOST_TEST_REQUIRE(mesh.triangles().size() >= expectedTriangles.size());
+  for (std::size_t i = 0; i < expectedTriangles.size(); ++i) {
+    for (int v = 0; v < 3; ++v) {
+      BOOST_TEST(&mesh.triangles()[i].vertex(v) == &expectedTriangles[i].vertex(v));
+    }
+  }
+
+  // All faces of tetrahedra and all edges of triangles exist exactly once
+  std::set<std::array<VertexID, 3>> faces;
+  for (auto &t : mesh.triangles()) {
+    std::array<VertexID, 3> ids{t.vertex(0).getID(), t.vertex(1).getID(), t.vertex(2).getID()};
+    std::sort(ids.begin(), ids.end());
+    faces.insert(ids);
+  }
+  BOOST_TEST(faces.size() == mesh.triangles().size());
+  for (auto &t : mesh.tetrahedra()) {
+    std::array<VertexID, 4> ids{t.vertex(0).getID(), t.vertex(1).getID(), t.vertex(2).getID(), t.vertex(3).getID()};
+    std::sort(ids.begin(), ids.end());
+    BOOST_TEST(faces.count({ids[0], ids[1], ids[2]}) == 1);
+    BOOST_TEST(faces.count({ids[1], ids[2], ids[3]}) == 1);
+  }
+  std::set<std::pair<VertexID, VertexID>> edges;
+  for (auto &e : mesh.edges()) {
+    edges.emplace(std::minmax(e.vertex(0).getID(), e.vertex(1).getID()));
+  }
+  BOOST_TEST(edges.size() == mesh.edges().size());
+}
+
 BOOST_AUTO_TEST_SUITE_END();
 BOOST_AUTO_TEST_SUITE_END() // Mesh
 BOOST_AUTO_TEST_SUITE_END() // Mesh
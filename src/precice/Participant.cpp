@@ -215,6 +215,73 @@ void Participant::readData(
   _impl->readData(toSV(meshName), toSV(dataName), ids, relativeReadTime, values);
 }
 
+MeshHandle Participant::getMeshHandle(::precice::string_view meshName) const
+{
+  return _impl->getMeshHandle(toSV(meshName));
+}
+
+DataHandle Participant::getDataHandle(::precice::string_view meshName, ::precice::string_view dataName) const
+{
+  return _impl->getDataHandle(toSV(meshName), toSV(dataName));
+}
+
+int Participant::getMeshDimensions(MeshHandle meshHandle) const
+{
+  return _impl->getMeshDimensions(meshHandle);
+}
+
+int Participant::getDataDimensions(DataHandle dataHandle) const
+{
+  return _impl->getDataDimensions(dataHandle);
+}
+
+void Participant::setMeshVertices(
+    MeshHandle                    meshHandle,
+    ::precice::span<const double> coordinates,
+    ::precice::span<VertexID>     ids)
+{
+  _impl->setMeshVertices(meshHandle, coordinates, ids);
+}
+
+void Participant::writeData(
+    DataHandle                      dataHandle,
+    ::precice::span<const VertexID> ids,
+    ::precice::span<const double>   values)
+{
+  _impl->writeData(dataHandle, ids, values);
+}
+
+void Participant::readData(
+    DataHandle                      dataHandle,
+    ::precice::span<const VertexID> ids,
+    double                          relativeReadTime,
+    ::precice::span<double>         values) const
+{
+  _impl->readData(dataHandle, ids, relativeReadTime, values);
+}
+
+::precice::span<double> Participant::getWriteBuffer(
+    ::precice::string_view meshName,
+    ::precice::string_view dataName)
+{
+  return _impl->getWriteBuffer(toSV(meshName), toSV(dataName));
+}
+
+::precice::span<double> Participant::getWriteBuffer(DataHandle dataHandle)
+{
+  return _impl->getWriteBuffer(dataHandle);
+}
+
+void Participant::startAdvance(double computedTimeStepSize)
+{
+  _impl->startAdvance(computedTimeStepSize);
+}
+
+void Participant::waitAdvance()
+{
+  _impl->waitAdvance();
+}
+
 void Participant::setMeshAccessRegion(::precice::string_view        meshName,
                                       ::precice::span<const double> boundingBox) const
 {
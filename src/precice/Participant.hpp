@@ -850,6 +850,104 @@ public:
 
   ///@}
 
+  /** @name Handle-based Access
+   *
+   * The access functions above identify meshes and data by their names, which preCICE resolves and validates in every call.
+   * Solvers calling these functions many times per time step, for instance per patch or per block, may instead resolve
+   * the names once after constructing the \ref Participant using \ref getMeshHandle() and \ref getDataHandle().
+   * The handle-based overloads then access the mesh or data directly and only validate the state of the Participant,
+   * the sizes of the arguments, and the vertex IDs.
+   *
+   * Handles remain valid for the whole lifetime of the \ref Participant.
+   *
+   * @{
+   */
+
+  /**
+   * @brief Resolves the given mesh to a handle.
+   *
+   * @param[in] meshName the name of the mesh
+   * @returns the handle of the mesh
+   *
+   * @pre the participant provides or receives the mesh
+   */
+  MeshHandle getMeshHandle(::precice::string_view meshName) const;
+
+  /**
+   * @brief Resolves the given data on the given mesh to a handle.
+   *
+   * @param[in] meshName the name of the mesh
+   * @param[in] dataName the name of the data
+   * @returns the handle of the data
+   *
+   * @pre the participant reads or writes the data on the mesh
+   */
+  DataHandle getDataHandle(::precice::string_view meshName, ::precice::string_view dataName) const;
+
+  /**
+   * @brief Returns the spatial dimensionality of the given mesh.
+   *
+   * @param[in] meshHandle the handle of the mesh as returned by getMeshHandle()
+   *
+   * @see getMeshDimensions(::precice::string_view)
+   */
+  int getMeshDimensions(MeshHandle meshHandle) const;
+
+  /**
+   * @brief Returns the spatial dimensionality of the given data.
+   *
+   * @param[in] dataHandle the handle of the data as returned by getDataHandle()
+   *
+   * @see getDataDimensions(::precice::string_view, ::precice::string_view)
+   */
+  int getDataDimensions(DataHandle dataHandle) const;
+
+  /**
+   * @brief Creates multiple mesh vertices
+   *
+   * @param[in] meshHandle the handle of the mesh as returned by getMeshHandle()
+   * @param[in] coordinates a span to the coordinates of the vertices
+   * @param[out] ids The ids of the created vertices
+   *
+   * @see setMeshVertices(::precice::string_view, ::precice::span<const double>, ::precice::span<VertexID>)
+   */
+  void setMeshVertices(
+      MeshHandle                    meshHandle,
+      ::precice::span<const double> coordinates,
+      ::precice::span<VertexID>     ids);
+
+  /**
+   * @brief Writes data to a mesh.
+   *
+   * @param[in] dataHandle the handle of the data as returned by getDataHandle()
+   * @param[in] ids the vertex ids of the vertices to write data to.
+   * @param[in] values the values to write to preCICE.
+   *
+   * @see writeData(::precice::string_view, ::precice::string_view, ::precice::span<const VertexID>, ::precice::span<const double>)
+   */
+  void writeData(
+      DataHandle                      dataHandle,
+      ::precice::span<const VertexID> ids,
+      ::precice::span<const double>   values);
+
+  /**
+   * @brief Reads data values from a mesh. Values correspond to a given point in time relative to the beginning of the current timestep.
+   *
+   * @param[in] dataHandle the handle of the data as returned by getDataHandle()
+   * @param[in] ids the vertex ids of the vertices to read data from.
+   * @param[in] relativeReadTime Point in time where data is read relative to the beginning of the current time step.
+   * @param[out] values the destination memory to read the data from.
+   *
+   * @see readData(::precice::string_view, ::precice::string_view, ::precice::span<const VertexID>, double, ::precice::span<double>)
+   */
+  void readData(
+      DataHandle                      dataHandle,
+      ::precice::span<const VertexID> ids,
+      double                          relativeReadTime,
+      ::precice::span<double>         values) const;
+
+  ///@}
+
   /** @name Direct Access
    *
    * If you want or need to provide your own data mapping scheme, then you
@@ -1022,6 +1120,101 @@ public:
 
   ///@}
 
+  /** @name Experimental: Direct Write Access
+   * These API functions are \b experimental and may change in future versions.
+   */
+  ///@{
+
+  /**
+   * @brief Provides direct write access to the buffer of data on a mesh.
+   *
+   * @experimental
+   *
+   * writeData() copies the given values into an internal buffer, which preCICE then turns into a sample in advance().
+   * Instead, solvers writing the values of all vertices can write directly into this buffer, which avoids the copy in writeData().
+   * This is not zero-copy: advance() still copies the buffered values once into the current values of the data.
+   *
+   * The buffer contains the values of all vertices of the mesh ordered by their vertex ID and follows the format of writeData().
+   * The values of the vertex with the ID `id` start at `id * getDataDimensions(meshName, dataName)`.
+   * Values written to the buffer behave like values passed to writeData() and are reset to 0 by advance().
+   *
+   * The returned view is invalidated by calls to initialize(), advance(), and functions modifying the mesh such as setMeshVertices().
+   * Request the buffer again in every time step.
+   *
+   * @param[in] meshName the name of mesh that hold the data.
+   * @param[in] dataName the name of the data to write to.
+   * @returns a writable view of size getDataDimensions(meshName, dataName) * getMeshVertexSize(meshName)
+   *
+   * @see Participant::writeData()
+   */
+  ::precice::span<double> getWriteBuffer(
+      ::precice::string_view meshName,
+      ::precice::string_view dataName);
+
+  /**
+   * @brief Provides direct write access to the buffer of data on a mesh.
+   *
+   * @experimental
+   *
+   * @param[in] dataHandle the handle of the data as returned by getDataHandle()
+   *
+   * @see getWriteBuffer(::precice::string_view, ::precice::string_view)
+   */
+  ::precice::span<double> getWriteBuffer(DataHandle dataHandle);
+
+  ///@}
+
+  /** @name Experimental: Asynchronous Advance
+   * These API functions are \b experimental and may change in future versions.
+   */
+  ///@{
+
+  /**
+   * @brief Starts advancing preCICE and returns before the coupling completes.
+   *
+   * @experimental
+   *
+   * This is the first half of advance().
+   * It processes the written data and then completes the coupling on a separate thread.
+   * This includes communication, acceleration, read mappings, and exports.
+   * In the meantime, the solver can prepare its next time step, e.g. assemble its system.
+   * Call waitAdvance() to complete the advance before accessing preCICE again.
+   *
+   * Between startAdvance() and waitAdvance(), only the following API functions may be called:
+   * getMeshDimensions(), getDataDimensions(), requiresMeshConnectivityFor(), requiresGradientDataFor(),
+   * getMeshHandle(), and getDataHandle().
+   * All other API functions result in an error.
+   * The participant is not thread-safe, hence, call these functions only from the thread which called startAdvance().
+   *
+   * The coupling is only completed on a separate thread if MPI is not used or provides MPI_THREAD_MULTIPLE.
+   * Otherwise, waitAdvance() completes the coupling on the calling thread.
+   *
+   * @param[in] computedTimeStepSize Size of time step used by the solver.
+   *
+   * @pre initialize() has been called successfully.
+   * @pre startAdvance() has not been called without a matching waitAdvance().
+   *
+   * @see advance()
+   * @see waitAdvance()
+   */
+  void startAdvance(double computedTimeStepSize);
+
+  /**
+   * @brief Waits until the advance started by startAdvance() has completed.
+   *
+   * @experimental
+   *
+   * After this call, the participant is in the same state as after advance().
+   * Errors, which occurred while completing the coupling, are raised by this call.
+   *
+   * @pre startAdvance() has been called.
+   *
+   * @see startAdvance()
+   */
+  void waitAdvance();
+
+  ///@}
+
   /// Disable copy construction
   Participant(const Participant &copy) = delete;
 
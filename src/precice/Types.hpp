@@ -12,4 +12,44 @@ namespace precice {
  */
 using VertexID = int;
 
+/**
+ * Type used to identify a mesh of a participant without resolving its name.
+ *
+ * Handles are bound to the \ref Participant returning them from \ref getMeshHandle().
+ * Using a handle of another Participant is not allowed and not guaranteed to result in an error.
+ *
+ * Handles are distinct types, which don't convert implicitly to integers, VertexIDs, or \ref DataHandle.
+ */
+struct MeshHandle {
+  /// Constructs a handle from its integer representation, which is only required by language bindings
+  constexpr explicit MeshHandle(int id)
+      : id(id) {}
+
+  /// The integer representation of the handle
+  int id;
+
+  constexpr bool operator==(MeshHandle other) const { return id == other.id; }
+  constexpr bool operator!=(MeshHandle other) const { return id != other.id; }
+};
+
+/**
+ * Type used to identify data on a mesh of a participant without resolving the mesh and data names.
+ *
+ * Handles are bound to the \ref Participant returning them from \ref getDataHandle().
+ * Using a handle of another Participant is not allowed and not guaranteed to result in an error.
+ *
+ * Handles are distinct types, which don't convert implicitly to integers, VertexIDs, or \ref MeshHandle.
+ */
+struct DataHandle {
+  /// Constructs a handle from its integer representation, which is only required by language bindings
+  constexpr explicit DataHandle(int id)
+      : id(id) {}
+
+  /// The integer representation of the handle
+  int id;
+
+  constexpr bool operator==(DataHandle other) const { return id == other.id; }
+  constexpr bool operator!=(DataHandle other) const { return id != other.id; }
+};
+
 } // namespace precice
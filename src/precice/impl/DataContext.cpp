@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <iterator>
 #include <memory>
 #include <utility>
@@ -87,6 +88,13 @@ bool DataContext::hasMapping() const
   return hasReadMapping() || hasWriteMapping();
 }
 
+bool DataContext::mapsToData(DataID dataID) const
+{
+  return std::any_of(_mappingContexts.begin(), _mappingContexts.end(), [dataID](const auto &context) {
+    return context.toData->getID() == dataID;
+  });
+}
+
 int DataContext::mapData(std::optional<double> after, bool skipZero)
 {
   PRECICE_TRACE(getMeshName(), getDataName());
@@ -125,9 +133,8 @@ int DataContext::mapData(std::optional<double> after, bool skipZero)
         continue;
       }
 
-      time::Sample outSample{
-          dataDims,
-          Eigen::VectorXd::Zero(dataDims * mapping.getOutputMesh()->nVertices())};
+      auto outSample = context.toData->timeStepsStorage().acquireSample(dataDims, dataDims * mapping.getOutputMesh()->nVertices());
+      outSample.setZero();
 
       // Note that the l2norm is only computed during initialization due to short-circuit evaluation in C++
       bool skipMapping = skipZero && (utils::IntraComm::l2norm(stample.sample.values) < math::NUMERICAL_ZERO_DIFFERENCE);
@@ -104,8 +104,16 @@ public:
    */
   bool hasMapping() const;
 
+  /**
+   * @brief Informs the user whether one of the mappings of this DataContext maps to the given data.
+   *
+   * @param[in] dataID ID of the data, which is the target of the mapping.
+   * @return True, if a _mappingContext maps to the data with the given ID.
+   */
+  bool mapsToData(DataID dataID) const;
+
   template <typename Container>
-  std::optional<std::size_t> locateInvalidVertexID(const Container &c)
+  std::optional<std::size_t> locateInvalidVertexID(const Container &c) const
   {
     return mesh::locateInvalidVertexID(*_mesh, c);
   }
@@ -4,9 +4,12 @@
 #include <array>
 #include <cmath>
 #include <deque>
+#include <exception>
 #include <functional>
+#include <future>
 #include <iterator>
 #include <memory>
+#include <numeric>
 #include <optional>
 #include <ostream>
 #include <sstream>
@@ -158,7 +161,23 @@ ParticipantImpl::ParticipantImpl(
 
 ParticipantImpl::~ParticipantImpl()
 {
-  if (_state != State::Finalized) {
+  bool advanceFailed = false;
+  if (_pendingAdvance.valid()) {
+    PRECICE_INFO("Implicitly waiting for the pending advance in destructor");
+    // Exceptions must not escape the destructor, and finalizing after a failed advance would act on a broken coupling state
+    try {
+      _pendingAdvance.get();
+    } catch (const ::precice::Error &) {
+      // Already logged when raised
+      advanceFailed = true;
+    } catch (const std::exception &e) {
+      _log.error(PRECICE_LOG_LOCATION, precice::utils::format_or_error("The pending advance failed with: {}", e.what()));
+      advanceFailed = true;
+    }
+  }
+  if (advanceFailed) {
+    PRECICE_WARN("Skipping the implicit finalize in destructor as the pending advance failed");
+  } else if (_state != State::Finalized) {
     PRECICE_INFO("Implicitly finalizing in destructor");
     finalize();
   }
@@ -236,6 +255,8 @@ void ParticipantImpl::configure(
   for (const MeshContext *meshContext : _accessor->usedMeshContexts()) {
     _meshLock.add(meshContext->mesh->getName(), false);
   }
+
+  configureHandles();
 }
 
 void ParticipantImpl::initialize()
@@ -304,9 +325,7 @@ void ParticipantImpl::initialize()
   }
 
   PRECICE_DEBUG("Initialize watchpoints");
-  for (PtrWatchPoint &watchPoint : _accessor->watchPoints()) {
-    watchPoint->initialize();
-  }
+  WatchPoint::initialize(_accessor->watchPoints());
   for (PtrWatchIntegral &watchIntegral : _accessor->watchIntegrals()) {
     watchIntegral->initialize();
   }
@@ -324,6 +343,22 @@ void ParticipantImpl::initialize()
   PRECICE_DEBUG("Initialize coupling schemes");
   _couplingScheme->initialize();
 
+  // Explicit schemes do not access mapped write data before sending it, hence, the mapping may be
+  // deferred until the data is sent. This is not possible if actions modify the mapped data.
+  bool hasWriteMappings = false;
+  for (const auto &context : _accessor->writeDataContexts()) {
+    hasWriteMappings |= context.hasMapping();
+  }
+  const auto &actions         = _accessor->actions();
+  const bool  hasWriteActions = std::any_of(actions.begin(), actions.end(), [](const auto &action) {
+    return action->getTiming() == action::Action::WRITE_MAPPING_POST;
+  });
+  _pipelineWriteMappings = hasWriteMappings && !hasWriteActions && !_couplingScheme->isImplicitCouplingScheme();
+  if (_pipelineWriteMappings) {
+    PRECICE_DEBUG("Pipeline write mappings with sending data");
+    _couplingScheme->setSendDataHook([this](DataID dataID) { mapPendingWrittenData(dataID); });
+  }
+
   mapInitialReadData();
   performDataActions({action::Action::READ_MAPPING_POST});
 
@@ -344,6 +379,7 @@ void ParticipantImpl::advance(
 {
 
   PRECICE_TRACE(computedTimeStepSize);
+  PRECICE_REQUIRE_NO_PENDING_ADVANCE();
 
   // Events for the solver time, stopped when we enter, restarted when we leave advance
   PRECICE_ASSERT(_solverAdvanceEvent, "The advance event is created in initialize");
@@ -352,6 +388,61 @@ void ParticipantImpl::advance(
   Event                        e("advance", profiling::Fundamental, profiling::Synchronize);
   profiling::ScopedEventPrefix sep("advance/");
 
+  const auto step = prepareAdvance(computedTimeStepSize);
+  completeAdvance(step);
+
+  sep.pop();
+  e.stop();
+  _solverAdvanceEvent->start();
+}
+
+void ParticipantImpl::startAdvance(
+    double computedTimeStepSize)
+{
+  PRECICE_TRACE(computedTimeStepSize);
+  PRECICE_EXPERIMENTAL_API();
+  PRECICE_REQUIRE_NO_PENDING_ADVANCE();
+
+  PRECICE_ASSERT(_solverAdvanceEvent, "The advance event is created in initialize");
+  _solverAdvanceEvent->stop();
+
+  Event                        e("advance", profiling::Fundamental, profiling::Synchronize);
+  profiling::ScopedEventPrefix sep("advance/");
+
+  const auto step = prepareAdvance(computedTimeStepSize);
+
+  // The solver may call MPI concurrently, which requires full thread support of MPI.
+  // Otherwise, waitAdvance() completes the advance on the calling thread.
+  const bool async = utils::Parallel::allowsConcurrentCalls();
+  PRECICE_DEBUG(async ? "Complete advance in the background" : "Complete advance in waitAdvance() as MPI does not provide MPI_THREAD_MULTIPLE");
+
+  // Profiling is not thread-safe, hence, the calling thread stops recording events before the coupling continues.
+  // The solver event thus covers the solver work overlapping the coupling and the time spent in waitAdvance().
+  // The API functions allowed while the advance is pending record no events, all others are rejected by PRECICE_REQUIRE_NO_PENDING_ADVANCE.
+  // Loggers are thread-safe and may be used by both threads.
+  sep.pop();
+  e.stop();
+  _solverAdvanceEvent->start();
+
+  _pendingAdvance = std::async(async ? std::launch::async : std::launch::deferred, [this, step] {
+    Event                        e("advance", profiling::Fundamental, profiling::Synchronize);
+    profiling::ScopedEventPrefix sep("advance/");
+    completeAdvance(step);
+  });
+}
+
+void ParticipantImpl::waitAdvance()
+{
+  PRECICE_TRACE();
+  PRECICE_EXPERIMENTAL_API();
+  PRECICE_CHECK(_pendingAdvance.valid(), "waitAdvance() can only be called after startAdvance().");
+
+  // Rethrows errors raised while completing the advance
+  _pendingAdvance.get();
+}
+
+ParticipantImpl::AdvanceStep ParticipantImpl::prepareAdvance(double computedTimeStepSize)
+{
   PRECICE_CHECK(_state != State::Constructed, "initialize() has to be called before advance().");
   PRECICE_CHECK(_state != State::Finalized, "advance() cannot be called after finalize().");
   PRECICE_CHECK(_state == State::Initialized, "initialize() has to be called before advance().");
@@ -369,19 +460,28 @@ void ParticipantImpl::advance(
 #endif
 
   // Update the coupling scheme time state. Necessary to get correct remainder.
-  const bool   isAtWindowEnd = _couplingScheme->addComputedTime(computedTimeStepSize);
-  const double timeSteppedTo = _couplingScheme->getTime();
-  const auto   dataToReceive = _couplingScheme->implicitDataToReceive();
+  AdvanceStep step;
+  step.isAtWindowEnd = _couplingScheme->addComputedTime(computedTimeStepSize);
+  step.timeSteppedTo = _couplingScheme->getTime();
+  step.dataToReceive = _couplingScheme->implicitDataToReceive();
+
+  handleDataBeforeAdvance(step.isAtWindowEnd, step.timeSteppedTo);
 
-  handleDataBeforeAdvance(isAtWindowEnd, timeSteppedTo);
+  return step;
+}
 
+void ParticipantImpl::completeAdvance(const AdvanceStep &step)
+{
   advanceCouplingScheme();
 
+  // Data which was not sent still requires its mapping
+  mapPendingWrittenData();
+
   // In clase if an implicit scheme, this may be before timeSteppedTo
   const double timeAfterAdvance   = _couplingScheme->getTime();
   const bool   timeWindowComplete = _couplingScheme->isTimeWindowComplete();
 
-  handleDataAfterAdvance(isAtWindowEnd, timeWindowComplete, timeSteppedTo, timeAfterAdvance, dataToReceive);
+  handleDataAfterAdvance(step.isAtWindowEnd, timeWindowComplete, step.timeSteppedTo, timeAfterAdvance, step.dataToReceive);
 
   PRECICE_INFO(_couplingScheme->printCouplingState());
 
@@ -389,10 +489,6 @@ void ParticipantImpl::advance(
                 _executedWriteMappings, _executedReadMappings);
 
   _meshLock.lockAll();
-
-  sep.pop();
-  e.stop();
-  _solverAdvanceEvent->start();
 }
 
 void ParticipantImpl::handleDataBeforeAdvance(bool reachedTimeWindowEnd, double timeSteppedTo)
@@ -407,8 +503,12 @@ void ParticipantImpl::handleDataBeforeAdvance(bool reachedTimeWindowEnd, double
   _executedWriteMappings = 0;
 
   if (reachedTimeWindowEnd) {
-    mapWrittenData(_couplingScheme->getTimeWindowStart());
-    performDataActions({action::Action::WRITE_MAPPING_POST});
+    if (_pipelineWriteMappings) {
+      deferWrittenDataMapping(_couplingScheme->getTimeWindowStart());
+    } else {
+      mapWrittenData(_couplingScheme->getTimeWindowStart());
+      performDataActions({action::Action::WRITE_MAPPING_POST});
+    }
   }
 }
 
@@ -478,6 +578,7 @@ void ParticipantImpl::trimSendDataAfter(double time)
 void ParticipantImpl::finalize()
 {
   PRECICE_TRACE();
+  PRECICE_REQUIRE_NO_PENDING_ADVANCE();
   PRECICE_CHECK(_state != State::Finalized, "finalize() may only be called once.");
 
   // Events for the solver time, finally stopped here
@@ -542,6 +643,7 @@ int ParticipantImpl::getDataDimensions(std::string_view meshName, std::string_vi
 bool ParticipantImpl::isCouplingOngoing() const
 {
   PRECICE_TRACE();
+  PRECICE_REQUIRE_NO_PENDING_ADVANCE();
   PRECICE_CHECK(_state != State::Finalized, "isCouplingOngoing() cannot be called after finalize().");
   PRECICE_CHECK(_state == State::Initialized, "initialize() has to be called before isCouplingOngoing() can be evaluated.");
   return _couplingScheme->isCouplingOngoing();
@@ -550,6 +652,7 @@ bool ParticipantImpl::isCouplingOngoing() const
 bool ParticipantImpl::isTimeWindowComplete() const
 {
   PRECICE_TRACE();
+  PRECICE_REQUIRE_NO_PENDING_ADVANCE();
   PRECICE_CHECK(_state != State::Constructed, "initialize() has to be called before isTimeWindowComplete().");
   PRECICE_CHECK(_state != State::Finalized, "isTimeWindowComplete() cannot be called after finalize().");
   return _couplingScheme->isTimeWindowComplete();
@@ -557,6 +660,7 @@ bool ParticipantImpl::isTimeWindowComplete() const
 
 double ParticipantImpl::getMaxTimeStepSize() const
 {
+  PRECICE_REQUIRE_NO_PENDING_ADVANCE();
   PRECICE_CHECK(_state != State::Finalized, "getMaxTimeStepSize() cannot be called after finalize().");
   PRECICE_CHECK(_state == State::Initialized, "initialize() has to be called before getMaxTimeStepSize() can be evaluated.");
   const double nextTimeStepSize = _couplingScheme->getNextTimeStepMaxSize();
@@ -586,6 +690,7 @@ bool ParticipantImpl::requiresInitialData()
 bool ParticipantImpl::requiresWritingCheckpoint()
 {
   PRECICE_TRACE();
+  PRECICE_REQUIRE_NO_PENDING_ADVANCE();
   PRECICE_CHECK(_state == State::Initialized, "initialize() has to be called before requiresWritingCheckpoint().");
   bool required = _couplingScheme->isActionRequired(cplscheme::CouplingScheme::Action::WriteCheckpoint);
   if (required) {
@@ -597,6 +702,7 @@ bool ParticipantImpl::requiresWritingCheckpoint()
 bool ParticipantImpl::requiresReadingCheckpoint()
 {
   PRECICE_TRACE();
+  PRECICE_REQUIRE_NO_PENDING_ADVANCE();
   PRECICE_CHECK(_state == State::Initialized, "initialize() has to be called before requiresReadingCheckpoint().");
   bool required = _couplingScheme->isActionRequired(cplscheme::CouplingScheme::Action::ReadCheckpoint);
   if (required) {
@@ -628,6 +734,7 @@ int ParticipantImpl::getMeshVertexSize(
     std::string_view meshName) const
 {
   PRECICE_TRACE(meshName);
+  PRECICE_REQUIRE_NO_PENDING_ADVANCE();
   PRECICE_REQUIRE_MESH_USE(meshName);
   // In case we access received mesh data: check, if the requested mesh data has already been received.
   // Otherwise, the function call doesn't make any sense
@@ -645,6 +752,7 @@ void ParticipantImpl::resetMesh(
 {
   PRECICE_EXPERIMENTAL_API();
   PRECICE_TRACE(meshName);
+  PRECICE_REQUIRE_NO_PENDING_ADVANCE();
   PRECICE_VALIDATE_MESH_NAME(meshName);
   impl::MeshContext &context = _accessor->usedMeshContext(meshName);
 
@@ -683,21 +791,26 @@ void ParticipantImpl::setMeshVertices(
 {
   PRECICE_TRACE(meshName, positions.size(), ids.size());
   PRECICE_REQUIRE_MESH_MODIFY(meshName);
-  MeshContext &context = _accessor->usedMeshContext(meshName);
-  auto &       mesh    = *context.mesh;
+  addMeshVertices(_accessor->usedMeshContext(meshName), positions, ids);
+}
+
+void ParticipantImpl::addMeshVertices(
+    MeshContext &                 context,
+    ::precice::span<const double> positions,
+    ::precice::span<VertexID>     ids)
+{
+  auto &mesh = *context.mesh;
 
   const auto meshDims             = mesh.getDimensions();
   const auto expectedPositionSize = ids.size() * meshDims;
   PRECICE_CHECK(positions.size() == expectedPositionSize,
                 "Input sizes are inconsistent attempting to set vertices on {}D mesh \"{}\". "
                 "You passed {} vertices indices and {} position components, but we expected {} position components ({} x {}).",
-                meshDims, meshName, ids.size(), positions.size(), expectedPositionSize, ids.size(), meshDims);
+                meshDims, mesh.getName(), ids.size(), positions.size(), expectedPositionSize, ids.size(), meshDims);
 
   const Eigen::Map<const Eigen::MatrixXd> posMatrix{
       positions.data(), mesh.getDimensions(), static_cast<EIGEN_DEFAULT_DENSE_INDEX_TYPE>(ids.size())};
-  for (unsigned long i = 0; i < ids.size(); ++i) {
-    ids[i] = mesh.createVertex(posMatrix.col(i)).getID();
-  }
+  std::iota(ids.begin(), ids.end(), mesh.createVertices(posMatrix));
   mesh.allocateDataValues();
 
   const auto newSize = mesh.nVertices();
@@ -745,8 +858,8 @@ void ParticipantImpl::setMeshEdges(
                 meshName, vertices.size());
   {
     auto end           = vertices.end();
-    auto [first, last] = utils::find_first_range(vertices.begin(), end, [&mesh](VertexID vid) {
-      return !mesh->isValidVertexID(vid);
+    auto [first, last] = utils::find_first_range(vertices.begin(), end, [nVertices = mesh->nVertices()](VertexID vid) {
+      return vid < 0 || static_cast<std::size_t>(vid) >= nVertices;
     });
     PRECICE_CHECK(first == end,
                   impl::errorInvalidVertexIDRange,
@@ -754,11 +867,7 @@ void ParticipantImpl::setMeshEdges(
                   std::distance(vertices.begin(), last));
   }
 
-  for (unsigned long i = 0; i < vertices.size() / 2; ++i) {
-    auto aid = vertices[2 * i];
-    auto bid = vertices[2 * i + 1];
-    mesh->createEdge(mesh->vertex(aid), mesh->vertex(bid));
-  }
+  mesh->createEdges(vertices);
 }
 
 void ParticipantImpl::setMeshTriangle(
@@ -816,8 +925,8 @@ void ParticipantImpl::setMeshTriangles(
                 meshName, vertices.size());
   {
     auto end           = vertices.end();
-    auto [first, last] = utils::find_first_range(vertices.begin(), end, [&mesh](VertexID vid) {
-      return !mesh->isValidVertexID(vid);
+    auto [first, last] = utils::find_first_range(vertices.begin(), end, [nVertices = mesh->nVertices()](VertexID vid) {
+      return vid < 0 || static_cast<std::size_t>(vid) >= nVertices;
     });
     PRECICE_CHECK(first == end,
                   impl::errorInvalidVertexIDRange,
@@ -825,14 +934,7 @@ void ParticipantImpl::setMeshTriangles(
                   std::distance(vertices.begin(), last));
   }
 
-  for (unsigned long i = 0; i < vertices.size() / 3; ++i) {
-    auto aid = vertices[3 * i];
-    auto bid = vertices[3 * i + 1];
-    auto cid = vertices[3 * i + 2];
-    mesh->createTriangle(mesh->vertex(aid),
-                         mesh->vertex(bid),
-                         mesh->vertex(cid));
-  }
+  mesh->createTriangles(vertices);
 }
 
 void ParticipantImpl::setMeshQuad(
@@ -905,8 +1007,8 @@ void ParticipantImpl::setMeshQuads(
                 meshName, vertices.size());
   {
     auto end           = vertices.end();
-    auto [first, last] = utils::find_first_range(vertices.begin(), end, [&mesh](VertexID vid) {
-      return !mesh.isValidVertexID(vid);
+    auto [first, last] = utils::find_first_range(vertices.begin(), end, [nVertices = mesh.nVertices()](VertexID vid) {
+      return vid < 0 || static_cast<std::size_t>(vid) >= nVertices;
     });
     PRECICE_CHECK(first == end,
                   impl::errorInvalidVertexIDRange,
@@ -996,8 +1098,8 @@ void ParticipantImpl::setMeshTetrahedra(
                 meshName, vertices.size());
   {
     auto end           = vertices.end();
-    auto [first, last] = utils::find_first_range(vertices.begin(), end, [&mesh](VertexID vid) {
-      return !mesh->isValidVertexID(vid);
+    auto [first, last] = utils::find_first_range(vertices.begin(), end, [nVertices = mesh->nVertices()](VertexID vid) {
+      return vid < 0 || static_cast<std::size_t>(vid) >= nVertices;
     });
     PRECICE_CHECK(first == end,
                   impl::errorInvalidVertexIDRange,
@@ -1005,16 +1107,7 @@ void ParticipantImpl::setMeshTetrahedra(
                   std::distance(vertices.begin(), last));
   }
 
-  for (unsigned long i = 0; i < vertices.size() / 4; ++i) {
-    auto aid = vertices[4 * i];
-    auto bid = vertices[4 * i + 1];
-    auto cid = vertices[4 * i + 2];
-    auto did = vertices[4 * i + 3];
-    mesh->createTetrahedron(mesh->vertex(aid),
-                            mesh->vertex(bid),
-                            mesh->vertex(cid),
-                            mesh->vertex(did));
-  }
+  mesh->createTetrahedra(vertices);
 }
 
 void ParticipantImpl::writeData(
@@ -1024,22 +1117,34 @@ void ParticipantImpl::writeData(
     ::precice::span<const double>   values)
 {
   PRECICE_TRACE(meshName, dataName, vertices.size());
+  PRECICE_REQUIRE_NO_PENDING_ADVANCE();
+  checkWriteDataState();
+  PRECICE_REQUIRE_DATA_WRITE(meshName, dataName);
+  writeValues(_accessor->writeDataContext(meshName, dataName), vertices, values);
+}
+
+void ParticipantImpl::checkWriteDataState() const
+{
   PRECICE_CHECK(_state != State::Finalized, "writeData(...) cannot be called after finalize().");
   PRECICE_CHECK(_state == State::Constructed || (_state == State::Initialized && isCouplingOngoing()), "Calling writeData(...) is forbidden if coupling is not ongoing, because the data you are trying to write will not be used anymore. You can fix this by always calling writeData(...) before the advance(...) call in your simulation loop or by using Participant::isCouplingOngoing() to implement a safeguard.");
-  PRECICE_REQUIRE_DATA_WRITE(meshName, dataName);
+}
+
+void ParticipantImpl::writeValues(
+    WriteDataContext &              context,
+    ::precice::span<const VertexID> vertices,
+    ::precice::span<const double>   values)
+{
   // Inconsistent sizes will be handled below
   if (vertices.empty() && values.empty()) {
     return;
   }
 
-  WriteDataContext &context = _accessor->writeDataContext(meshName, dataName);
-
   const auto dataDims         = context.getDataDimensions();
   const auto expectedDataSize = vertices.size() * dataDims;
   PRECICE_CHECK(expectedDataSize == values.size(),
                 "Input sizes are inconsistent attempting to write {}D data \"{}\" to mesh \"{}\". "
                 "You passed {} vertices and {} data components, but we expected {} data components ({} x {}).",
-                dataDims, dataName, meshName,
+                dataDims, context.getDataName(), context.getMeshName(),
                 vertices.size(), values.size(), expectedDataSize, dataDims, vertices.size());
 
   // Sizes are correct at this point
@@ -1048,7 +1153,7 @@ void ParticipantImpl::writeData(
   if (auto index = context.locateInvalidVertexID(vertices); index) {
     PRECICE_ERROR("Cannot write data \"{}\" to mesh \"{}\" due to invalid Vertex ID at vertices[{}]. "
                   "Please make sure you only use the results from calls to setMeshVertex/Vertices().",
-                  dataName, meshName, *index);
+                  context.getDataName(), context.getMeshName(), *index);
   }
   context.writeValuesIntoDataBuffer(vertices, values);
 }
@@ -1061,37 +1166,49 @@ void ParticipantImpl::readData(
     ::precice::span<double>         values) const
 {
   PRECICE_TRACE(meshName, dataName, vertices.size(), relativeReadTime);
+  PRECICE_REQUIRE_NO_PENDING_ADVANCE();
+  checkReadDataState(relativeReadTime);
+  PRECICE_REQUIRE_DATA_READ(meshName, dataName);
+  readValues(_accessor->readDataContext(meshName, dataName), vertices, relativeReadTime, values);
+}
+
+void ParticipantImpl::checkReadDataState(double relativeReadTime) const
+{
   PRECICE_CHECK(_state != State::Constructed, "readData(...) cannot be called before initialize().");
   PRECICE_CHECK(_state != State::Finalized, "readData(...) cannot be called after finalize().");
   PRECICE_CHECK(math::smallerEquals(relativeReadTime, _couplingScheme->getNextTimeStepMaxSize()), "readData(...) cannot sample data outside of current time window.");
   PRECICE_CHECK(relativeReadTime >= 0, "readData(...) cannot sample data before the current time.");
   PRECICE_CHECK(isCouplingOngoing() || math::equals(relativeReadTime, 0.0), "Calling readData(...) with relativeReadTime = {} is forbidden if coupling is not ongoing. If coupling finished, only data for relativeReadTime = 0 is available. Please always use precice.getMaxTimeStepSize() to obtain the maximum allowed relativeReadTime.", relativeReadTime);
+}
 
-  PRECICE_REQUIRE_DATA_READ(meshName, dataName);
-
+void ParticipantImpl::readValues(
+    const ReadDataContext &         context,
+    ::precice::span<const VertexID> vertices,
+    double                          relativeReadTime,
+    ::precice::span<double>         values) const
+{
   // Inconsistent sizes will be handled below
   if (vertices.empty() && values.empty()) {
     return;
   }
 
-  ReadDataContext &context = _accessor->readDataContext(meshName, dataName);
   PRECICE_CHECK(context.hasSamples(), "Data \"{}\" cannot be read from mesh \"{}\" as it contains no samples. "
                                       "This is typically a configuration issue of the data flow. "
                                       "Check if the data is correctly exchanged to this participant \"{}\" and mapped to mesh \"{}\".",
-                dataName, meshName, _accessorName, meshName);
+                context.getDataName(), context.getMeshName(), _accessorName, context.getMeshName());
 
   const auto dataDims         = context.getDataDimensions();
   const auto expectedDataSize = vertices.size() * dataDims;
   PRECICE_CHECK(expectedDataSize == values.size(),
                 "Input/Output sizes are inconsistent attempting to read {}D data \"{}\" from mesh \"{}\". "
                 "You passed {} vertices and {} data components, but we expected {} data components ({} x {}).",
-                dataDims, dataName, meshName,
+                dataDims, context.getDataName(), context.getMeshName(),
                 vertices.size(), values.size(), expectedDataSize, dataDims, vertices.size());
 
   if (auto index = context.locateInvalidVertexID(vertices); index) {
     PRECICE_ERROR("Cannot read data \"{}\" from mesh \"{}\" due to invalid Vertex ID at vertices[{}]. "
                   "Please make sure you only use the results from calls to setMeshVertex/Vertices().",
-                  dataName, meshName, *index);
+                  context.getDataName(), context.getMeshName(), *index);
   }
 
   double readTime = _couplingScheme->getTime() + relativeReadTime;
@@ -1105,6 +1222,7 @@ void ParticipantImpl::writeGradientData(
     ::precice::span<const double>   gradients)
 {
   PRECICE_EXPERIMENTAL_API();
+  PRECICE_REQUIRE_NO_PENDING_ADVANCE();
 
   // Asserts and checks
   PRECICE_TRACE(meshName, dataName, vertices.size());
@@ -1145,6 +1263,154 @@ void ParticipantImpl::writeGradientData(
   context.writeGradientsIntoDataBuffer(vertices, gradients);
 }
 
+void ParticipantImpl::configureHandles()
+{
+  PRECICE_TRACE();
+  _meshHandles.assign(_accessor->usedMeshContexts().begin(), _accessor->usedMeshContexts().end());
+
+  _dataHandles.clear();
+  for (auto &context : _accessor->writeDataContexts()) {
+    _dataHandles.push_back({nullptr, &context});
+  }
+  for (auto &context : _accessor->readDataContexts()) {
+    _dataHandles.push_back({&context, nullptr});
+  }
+}
+
+MeshHandle ParticipantImpl::getMeshHandle(std::string_view meshName) const
+{
+  PRECICE_TRACE(meshName);
+  PRECICE_REQUIRE_MESH_USE(meshName);
+  auto pos = std::find_if(_meshHandles.begin(), _meshHandles.end(), [meshName](const MeshContext *context) {
+    return context->mesh->getName() == meshName;
+  });
+  PRECICE_ASSERT(pos != _meshHandles.end());
+  return MeshHandle{static_cast<int>(std::distance(_meshHandles.begin(), pos))};
+}
+
+DataHandle ParticipantImpl::getDataHandle(std::string_view meshName, std::string_view dataName) const
+{
+  PRECICE_TRACE(meshName, dataName);
+  PRECICE_VALIDATE_DATA_NAME(meshName, dataName);
+  PRECICE_CHECK(_accessor->isDataRead(meshName, dataName) || _accessor->isDataWrite(meshName, dataName),
+                "This participant does not use data \"{0}\" via mesh \"{2}\", but attempted to access it. "
+                "Please extend the configuration of participant \"{1}\" by defining <read-data mesh=\"{2}\" name=\"{0}\" /> "
+                "or <write-data mesh=\"{2}\" name=\"{0}\" />.",
+                dataName, _accessorName, meshName);
+  auto pos = std::find_if(_dataHandles.begin(), _dataHandles.end(), [meshName, dataName](const DataHandleContexts &handle) {
+    const DataContext *context = handle.read ? static_cast<const DataContext *>(handle.read) : handle.write;
+    return context->getMeshName() == meshName && context->getDataName() == dataName;
+  });
+  PRECICE_ASSERT(pos != _dataHandles.end());
+  return DataHandle{static_cast<int>(std::distance(_dataHandles.begin(), pos))};
+}
+
+MeshContext &ParticipantImpl::meshContext(MeshHandle meshHandle) const
+{
+  PRECICE_CHECK(meshHandle.id >= 0 && static_cast<std::size_t>(meshHandle.id) < _meshHandles.size(),
+                "The mesh handle {} is unknown to preCICE. "
+                "Please only use handles returned by getMeshHandle() of this participant.",
+                meshHandle.id);
+  return *_meshHandles[meshHandle.id];
+}
+
+const ParticipantImpl::DataHandleContexts &ParticipantImpl::dataHandleContexts(DataHandle dataHandle) const
+{
+  PRECICE_CHECK(dataHandle.id >= 0 && static_cast<std::size_t>(dataHandle.id) < _dataHandles.size(),
+                "The data handle {} is unknown to preCICE. "
+                "Please only use handles returned by getDataHandle() of this participant.",
+                dataHandle.id);
+  return _dataHandles[dataHandle.id];
+}
+
+int ParticipantImpl::getMeshDimensions(MeshHandle meshHandle) const
+{
+  PRECICE_TRACE(meshHandle.id);
+  return meshContext(meshHandle).mesh->getDimensions();
+}
+
+int ParticipantImpl::getDataDimensions(DataHandle dataHandle) const
+{
+  PRECICE_TRACE(dataHandle.id);
+  const auto &handle = dataHandleContexts(dataHandle);
+  return handle.read ? handle.read->getDataDimensions() : handle.write->getDataDimensions();
+}
+
+void ParticipantImpl::setMeshVertices(
+    MeshHandle                    meshHandle,
+    ::precice::span<const double> positions,
+    ::precice::span<VertexID>     ids)
+{
+  PRECICE_TRACE(meshHandle.id, positions.size(), ids.size());
+  PRECICE_REQUIRE_NO_PENDING_ADVANCE();
+  MeshContext &context = meshContext(meshHandle);
+  PRECICE_CHECK(context.provideMesh,
+                "This participant does not provide Mesh \"{0}\", but attempted to modify it. "
+                "Please add a provide-mesh tag as follows <provide-mesh name=\"{0}\" />.",
+                context.mesh->getName());
+  PRECICE_CHECK(!_meshLock.check(context.mesh->getName()),
+                "This participant attempted to modify the Mesh \"{}\" while locked. "
+                "Mesh modification is only allowed before calling initialize().",
+                context.mesh->getName());
+  addMeshVertices(context, positions, ids);
+}
+
+void ParticipantImpl::writeData(
+    DataHandle                      dataHandle,
+    ::precice::span<const VertexID> vertices,
+    ::precice::span<const double>   values)
+{
+  PRECICE_TRACE(dataHandle.id, vertices.size());
+  PRECICE_REQUIRE_NO_PENDING_ADVANCE();
+  checkWriteDataState();
+  const auto &handle = dataHandleContexts(dataHandle);
+  PRECICE_CHECK(handle.write != nullptr,
+                "This participant does not write data \"{}\" via mesh \"{}\", but attempted to write it using the data handle {}.",
+                handle.read->getDataName(), handle.read->getMeshName(), dataHandle.id);
+  writeValues(*handle.write, vertices, values);
+}
+
+void ParticipantImpl::readData(
+    DataHandle                      dataHandle,
+    ::precice::span<const VertexID> vertices,
+    double                          relativeReadTime,
+    ::precice::span<double>         values) const
+{
+  PRECICE_TRACE(dataHandle.id, vertices.size(), relativeReadTime);
+  PRECICE_REQUIRE_NO_PENDING_ADVANCE();
+  checkReadDataState(relativeReadTime);
+  const auto &handle = dataHandleContexts(dataHandle);
+  PRECICE_CHECK(handle.read != nullptr,
+                "This participant does not read data \"{}\" via mesh \"{}\", but attempted to read it using the data handle {}.",
+                handle.write->getDataName(), handle.write->getMeshName(), dataHandle.id);
+  readValues(*handle.read, vertices, relativeReadTime, values);
+}
+
+::precice::span<double> ParticipantImpl::getWriteBuffer(
+    std::string_view meshName,
+    std::string_view dataName)
+{
+  PRECICE_TRACE(meshName, dataName);
+  PRECICE_REQUIRE_NO_PENDING_ADVANCE();
+  PRECICE_EXPERIMENTAL_API();
+  checkWriteDataState();
+  PRECICE_REQUIRE_DATA_WRITE(meshName, dataName);
+  return _accessor->writeDataContext(meshName, dataName).writeBuffer();
+}
+
+::precice::span<double> ParticipantImpl::getWriteBuffer(DataHandle dataHandle)
+{
+  PRECICE_TRACE(dataHandle.id);
+  PRECICE_REQUIRE_NO_PENDING_ADVANCE();
+  PRECICE_EXPERIMENTAL_API();
+  checkWriteDataState();
+  const auto &handle = dataHandleContexts(dataHandle);
+  PRECICE_CHECK(handle.write != nullptr,
+                "This participant does not write data \"{}\" via mesh \"{}\", but attempted to write it using the data handle {}.",
+                handle.read->getDataName(), handle.read->getMeshName(), dataHandle.id);
+  return handle.write->writeBuffer();
+}
+
 void ParticipantImpl::setMeshAccessRegion(
     const std::string_view        meshName,
     ::precice::span<const double> boundingBox) const
@@ -1189,6 +1455,7 @@ void ParticipantImpl::getMeshVertexIDsAndCoordinates(
     ::precice::span<double>   coordinates) const
 {
   PRECICE_TRACE(meshName, ids.size(), coordinates.size());
+  PRECICE_REQUIRE_NO_PENDING_ADVANCE();
   PRECICE_REQUIRE_MESH_USE(meshName);
   PRECICE_DEBUG("Get {} mesh vertices with IDs", ids.size());
 
@@ -1430,6 +1697,45 @@ void ParticipantImpl::mapWrittenData(std::optional<double> after)
   }
 }
 
+void ParticipantImpl::deferWrittenDataMapping(double after)
+{
+  PRECICE_TRACE(after);
+  PRECICE_ASSERT(_pendingWriteMappings.empty());
+  // Mappings are computed upfront, as this requires communication in parallel runs
+  computeMappings(_accessor->writeMappingContexts(), "write");
+  for (auto &context : _accessor->writeDataContexts()) {
+    if (context.hasMapping()) {
+      _pendingWriteMappings.push_back(&context);
+    }
+  }
+  _pendingWriteMappingsAfter = after;
+}
+
+void ParticipantImpl::mapPendingWrittenData(DataID dataID)
+{
+  PRECICE_TRACE(dataID);
+  for (auto it = _pendingWriteMappings.begin(); it != _pendingWriteMappings.end();) {
+    auto &context = **it;
+    if (context.mapsToData(dataID)) {
+      PRECICE_DEBUG("Map write data \"{}\" from mesh \"{}\" before sending it", context.getDataName(), context.getMeshName());
+      _executedWriteMappings += context.mapData(_pendingWriteMappingsAfter);
+      it = _pendingWriteMappings.erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
+
+void ParticipantImpl::mapPendingWrittenData()
+{
+  PRECICE_TRACE();
+  for (auto context : _pendingWriteMappings) {
+    PRECICE_DEBUG("Map write data \"{}\" from mesh \"{}\"", context->getDataName(), context->getMeshName());
+    _executedWriteMappings += context->mapData(_pendingWriteMappingsAfter);
+  }
+  _pendingWriteMappings.clear();
+}
+
 void ParticipantImpl::trimReadMappedData(double startOfTimeWindow, bool isTimeWindowComplete, const cplscheme::ImplicitData &fromData)
 {
   PRECICE_TRACE();
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstddef>
+#include <future>
 #include <map>
 #include <set>
 #include <string>
@@ -52,6 +53,10 @@ class Mesh;
 
 namespace impl {
 
+struct MeshContext;
+class ReadDataContext;
+class WriteDataContext;
+
 /// Implementation of Participant. See also pimpl ideom (https://en.cppreference.com/w/cpp/language/pimpl).
 class ParticipantImpl {
 public:
@@ -243,6 +248,61 @@ public:
       ::precice::span<const VertexID> vertices,
       ::precice::span<const double>   gradients);
 
+  /// @copydoc Participant::getWriteBuffer(::precice::string_view, ::precice::string_view)
+  ::precice::span<double> getWriteBuffer(
+      std::string_view meshName,
+      std::string_view dataName);
+
+  /// @copydoc Participant::getWriteBuffer(DataHandle)
+  ::precice::span<double> getWriteBuffer(DataHandle dataHandle);
+
+  ///@}
+
+  ///@name Experimental Asynchronous Advance
+  ///@{
+
+  /// @copydoc Participant::startAdvance
+  void startAdvance(double computedTimeStepSize);
+
+  /// @copydoc Participant::waitAdvance
+  void waitAdvance();
+
+  ///@}
+
+  ///@name Handle-based Access
+  ///@{
+
+  /// @copydoc Participant::getMeshHandle
+  MeshHandle getMeshHandle(std::string_view meshName) const;
+
+  /// @copydoc Participant::getDataHandle
+  DataHandle getDataHandle(std::string_view meshName, std::string_view dataName) const;
+
+  /// @copydoc Participant::getMeshDimensions(MeshHandle) const
+  int getMeshDimensions(MeshHandle meshHandle) const;
+
+  /// @copydoc Participant::getDataDimensions(DataHandle) const
+  int getDataDimensions(DataHandle dataHandle) const;
+
+  /// @copydoc Participant::setMeshVertices(MeshHandle, ::precice::span<const double>, ::precice::span<VertexID>)
+  void setMeshVertices(
+      MeshHandle                    meshHandle,
+      ::precice::span<const double> positions,
+      ::precice::span<VertexID>     ids);
+
+  /// @copydoc Participant::writeData(DataHandle, ::precice::span<const VertexID>, ::precice::span<const double>)
+  void writeData(
+      DataHandle                      dataHandle,
+      ::precice::span<const VertexID> vertices,
+      ::precice::span<const double>   values);
+
+  /// @copydoc Participant::readData(DataHandle, ::precice::span<const VertexID>, double, ::precice::span<double>) const
+  void readData(
+      DataHandle                      dataHandle,
+      ::precice::span<const VertexID> vertices,
+      double                          relativeReadTime,
+      ::precice::span<double>         values) const;
+
   ///@}
 
   /** @name Direct Access
@@ -312,6 +372,16 @@ private:
 
   cplscheme::PtrCouplingScheme _couplingScheme;
 
+  /// The contexts of the used meshes indexed by their MeshHandle
+  std::vector<MeshContext *> _meshHandles;
+
+  /// The read and write contexts of data indexed by their DataHandle
+  struct DataHandleContexts {
+    ReadDataContext * read  = nullptr;
+    WriteDataContext *write = nullptr;
+  };
+  std::vector<DataHandleContexts> _dataHandles;
+
   /// Represents the various states a Participant can be in.
   enum struct State {
     Constructed, // Initial state of Participant
@@ -337,6 +407,18 @@ private:
   /// Counts the amount of samples mapped in read mappings executed in the latest advance
   int _executedReadMappings = 0;
 
+  /// Are write mappings deferred until the coupling scheme sends the mapped data?
+  bool _pipelineWriteMappings = false;
+
+  /// Write data contexts whose mapping is deferred in the current advance
+  std::vector<WriteDataContext *> _pendingWriteMappings;
+
+  /// Time after which the pending write mappings map samples
+  double _pendingWriteMappingsAfter = 0.0;
+
+  /// Completion of the advance started by startAdvance(), valid until waitAdvance()
+  std::future<void> _pendingAdvance;
+
   /**
    * @brief Configures the coupling interface from the given xml file.
    *
@@ -385,6 +467,21 @@ private:
   /// Computes, and performs suitable write mappings either entirely or after given time
   void mapWrittenData(std::optional<double> after = std::nullopt);
 
+  /**
+   * @brief Defers the write mappings after the given time until their data is sent.
+   *
+   * Mapping a data then overlaps with the asynchronous send of the previously sent data.
+   *
+   * @see mapPendingWrittenData()
+   */
+  void deferWrittenDataMapping(double after);
+
+  /// Performs the pending write mappings, which map to the given data
+  void mapPendingWrittenData(DataID dataID);
+
+  /// Performs all pending write mappings
+  void mapPendingWrittenData();
+
   // Computes, and performs read mappings of the initial data in initialize
   void mapInitialReadData();
 
@@ -413,6 +510,30 @@ private:
    */
   void resetWrittenData(); //bool isAtWindowEnd, bool isTimeWindowComplete);
 
+  /// Assigns the handles of all used meshes and data after the configuration
+  void configureHandles();
+
+  /// Returns the context of a mesh handle after validating it
+  MeshContext &meshContext(MeshHandle meshHandle) const;
+
+  /// Returns the contexts of a data handle after validating it
+  const DataHandleContexts &dataHandleContexts(DataHandle dataHandle) const;
+
+  /// Checks that the state of the participant allows writing data
+  void checkWriteDataState() const;
+
+  /// Checks that the state of the participant allows reading data at the given relative time
+  void checkReadDataState(double relativeReadTime) const;
+
+  /// Adds vertices to the mesh of an unlocked and provided mesh context
+  void addMeshVertices(MeshContext &context, ::precice::span<const double> positions, ::precice::span<VertexID> ids);
+
+  /// Writes values to the buffer of a resolved write data context
+  void writeValues(WriteDataContext &context, ::precice::span<const VertexID> vertices, ::precice::span<const double> values);
+
+  /// Reads values from a resolved read data context
+  void readValues(const ReadDataContext &context, ::precice::span<const VertexID> vertices, double relativeReadTime, ::precice::span<double> values) const;
+
   /// Determines participant accessing this interface from the configuration.
   impl::PtrParticipant determineAccessingParticipant(
       const config::Configuration &config);
@@ -435,6 +556,19 @@ private:
   /// Syncs the primary ranks of all connected participants
   void closeCommunicationChannels(CloseChannels cc);
 
+  /// State of an advance, which is passed from its preparation to its completion
+  struct AdvanceStep {
+    bool                    isAtWindowEnd;
+    double                  timeSteppedTo;
+    cplscheme::ImplicitData dataToReceive;
+  };
+
+  /// Validates the call, adds the time step to the coupling scheme and handles the written data
+  AdvanceStep prepareAdvance(double computedTimeStepSize);
+
+  /// Advances the coupling scheme and handles the received data
+  void completeAdvance(const AdvanceStep &step);
+
   /// Completes everything data-related between adding time to and advancing the coupling scheme
   void handleDataBeforeAdvance(bool reachedTimeWindowEnd, double timeSteppedTo);
 
@@ -375,9 +375,7 @@ void ParticipantState::exportIntermediate(IntermediateExport exp)
       watchPoint->exportPointData(exp.time);
     }
 
-    for (const PtrWatchIntegral &watchIntegral : watchIntegrals()) {
-      watchIntegral->exportIntegralData(exp.time);
-    }
+    WatchIntegral::exportIntegralData(watchIntegrals(), exp.time);
   }
 }
 
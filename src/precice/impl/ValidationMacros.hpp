@@ -49,6 +49,7 @@
  */
 #define PRECICE_REQUIRE_MESH_MODIFY_IMPL(name)                                        \
   PRECICE_REQUIRE_MESH_PROVIDE_IMPL(name)                                             \
+  PRECICE_REQUIRE_NO_PENDING_ADVANCE();                                               \
   PRECICE_CHECK(!_meshLock.check(name),                                               \
                 "This participant attempted to modify the Mesh \"{}\" while locked. " \
                 "Mesh modification is only allowed before calling initialize().",     \
@@ -166,3 +167,10 @@
                                      "You may unlock the full API by specifying <precice-configuration experimental=\"true\" ... > in the configuration. " \
                                      "Please be aware that experimental features may change in any future version (even minor or bugfix).",                \
                 __func__)
+
+/** Ensures that no advance started by startAdvance() is pending
+ */
+#define PRECICE_REQUIRE_NO_PENDING_ADVANCE()                                                                              \
+  PRECICE_CHECK(!_pendingAdvance.valid(), "You called the API function \"{}\" between startAdvance() and waitAdvance(). " \
+                                          "Please call waitAdvance() first.",                                             \
+                __func__)
@@ -1,5 +1,7 @@
 #include "WatchIntegral.hpp"
 #include <Eigen/Core>
+#include <utility>
+#include <vector>
 #include "logging/LogMacros.hpp"
 #include "mesh/Data.hpp"
 #include "mesh/Edge.hpp"
@@ -17,7 +19,7 @@ WatchIntegral::WatchIntegral(
     const std::string &exportFilename,
     bool               isScalingOn)
     : _mesh(std::move(meshToWatch)),
-      _txtWriter(exportFilename),
+      _txtWriter(exportFilename, false),
       _isScalingOn(isScalingOn)
 {
   PRECICE_ASSERT(_mesh);
@@ -59,49 +61,89 @@ void WatchIntegral::initialize()
 void WatchIntegral::exportIntegralData(
     double time)
 {
-
-  if (not utils::IntraComm::isSecondary()) {
-    _txtWriter.writeData("Time", time);
+  Eigen::VectorXd integrals = calculateIntegrals();
+  if (utils::IntraComm::getSize() > 1) {
+    Eigen::VectorXd integralsSum = Eigen::VectorXd::Zero(integrals.size());
+    utils::IntraComm::reduceSum(integrals, integralsSum);
+    integrals = std::move(integralsSum);
   }
+  writeIntegrals(time, integrals);
+}
 
-  for (auto &elem : _dataToExport) {
-    const int dataDimensions = elem->getDimensions();
-    auto      integral       = calculateIntegral(elem);
+void WatchIntegral::exportIntegralData(
+    const std::vector<PtrWatchIntegral> &watchIntegrals,
+    double                               time)
+{
+  std::vector<Eigen::VectorXd> integrals;
+  integrals.reserve(watchIntegrals.size());
+  Eigen::Index size = 0;
+  for (const auto &watchIntegral : watchIntegrals) {
+    integrals.push_back(watchIntegral->calculateIntegrals());
+    size += integrals.back().size();
+  }
 
-    if (utils::IntraComm::getSize() > 1) {
-      Eigen::VectorXd valueRecv = Eigen::VectorXd::Zero(dataDimensions);
-      utils::IntraComm::reduceSum(integral, valueRecv);
-      integral = std::move(valueRecv);
+  // Empty partitions also take part in the reduction to prevent a deadlock
+  if (utils::IntraComm::getSize() > 1 && size > 0) {
+    Eigen::VectorXd local(size);
+    Eigen::Index    offset = 0;
+    for (const auto &integral : integrals) {
+      local.segment(offset, integral.size()) = integral;
+      offset += integral.size();
     }
-    if (not utils::IntraComm::isSecondary()) {
-      if (dataDimensions == 1) {
-        _txtWriter.writeData(elem->getName(), integral[0]);
-      } else if (dataDimensions == 2) {
-        _txtWriter.writeData(elem->getName(), Eigen::Vector2d(integral));
-      } else {
-        _txtWriter.writeData(elem->getName(), Eigen::Vector3d(integral));
-      }
+    Eigen::VectorXd global = Eigen::VectorXd::Zero(size);
+    utils::IntraComm::reduceSum(local, global);
+    offset = 0;
+    for (auto &integral : integrals) {
+      integral = global.segment(offset, integral.size());
+      offset += integral.size();
     }
   }
 
+  for (std::size_t i = 0; i < watchIntegrals.size(); ++i) {
+    watchIntegrals[i]->writeIntegrals(time, integrals[i]);
+  }
+}
+
+Eigen::VectorXd WatchIntegral::calculateIntegrals() const
+{
+  Eigen::Index size = 1;
+  for (const auto &data : _dataToExport) {
+    size += data->getDimensions();
+  }
+
+  Eigen::VectorXd integrals(size);
+  Eigen::Index    offset = 0;
+  for (const auto &data : _dataToExport) {
+    integrals.segment(offset, data->getDimensions()) = calculateIntegral(data);
+    offset += data->getDimensions();
+  }
   // Calculate surface area only if there is connectivity information
-  if (not _mesh->edges().empty()) {
-    double surfaceArea = calculateSurfaceArea();
-    if (utils::IntraComm::getSize() > 1) {
-      double surfaceAreaSum = 0.0;
-      utils::IntraComm::reduceSum(surfaceArea, surfaceAreaSum);
-      surfaceArea = surfaceAreaSum;
-    }
-    if (not utils::IntraComm::isSecondary()) {
-      _txtWriter.writeData("SurfaceArea", surfaceArea);
-    }
-  } else {
-    // Empty partitions should also call reduceSum to prevent deadlock
-    if (utils::IntraComm::getSize() > 1) {
-      double surfaceArea    = 0.0;
-      double surfaceAreaSum = 0.0;
-      utils::IntraComm::reduceSum(surfaceArea, surfaceAreaSum);
+  integrals[offset] = _mesh->edges().empty() ? 0.0 : calculateSurfaceArea();
+  return integrals;
+}
+
+void WatchIntegral::writeIntegrals(double time, const Eigen::VectorXd &integrals)
+{
+  if (utils::IntraComm::isSecondary()) {
+    return;
+  }
+
+  _txtWriter.writeData("Time", time);
+  Eigen::Index offset = 0;
+  for (const auto &data : _dataToExport) {
+    const int dataDimensions = data->getDimensions();
+    if (dataDimensions == 1) {
+      _txtWriter.writeData(data->getName(), integrals[offset]);
+    } else if (dataDimensions == 2) {
+      _txtWriter.writeData(data->getName(), Eigen::Vector2d(integrals.segment<2>(offset)));
+    } else {
+      _txtWriter.writeData(data->getName(), Eigen::Vector3d(integrals.segment<3>(offset)));
     }
+    offset += dataDimensions;
+  }
+
+  if (not _mesh->edges().empty()) {
+    _txtWriter.writeData("SurfaceArea", integrals[offset]);
   }
 }
 
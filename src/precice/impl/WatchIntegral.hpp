@@ -3,6 +3,7 @@
 #include <Eigen/Core>
 #include <string>
 #include <vector>
+#include "SharedPointer.hpp"
 #include "io/TXTTableWriter.hpp"
 #include "logging/Logger.hpp"
 #include "mesh/SharedPointer.hpp"
@@ -41,6 +42,13 @@ public:
   /// Writes one line with data of the integral over the mesh into the output file.
   void exportIntegralData(double time);
 
+  /** Writes one line for each of several watch integrals.
+   *
+   * In parallel, the integrals of all watch integrals are summed up in a single reduction.
+   * All ranks have to pass the same watch integrals in the same order.
+   */
+  static void exportIntegralData(const std::vector<PtrWatchIntegral> &watchIntegrals, double time);
+
   /// Adds surface area information based on mesh connectivity
   void initialize();
 
@@ -55,6 +63,12 @@ private:
 
   bool _isScalingOn;
 
+  /// Returns the local integrals of all data followed by the local surface area
+  Eigen::VectorXd calculateIntegrals() const;
+
+  /// Writes the summed up integrals in the layout of calculateIntegrals() on the primary rank
+  void writeIntegrals(double time, const Eigen::VectorXd &integrals);
+
   Eigen::VectorXd calculateIntegral(const mesh::PtrData &data) const;
 
   double calculateSurfaceArea() const;
@@ -4,6 +4,7 @@
 #include <memory>
 #include <ostream>
 #include <utility>
+#include <vector>
 
 #include "WatchPoint.hpp"
 #include "com/Communication.hpp"
@@ -16,18 +17,58 @@
 #include "mesh/Triangle.hpp"
 #include "mesh/Vertex.hpp"
 #include "precice/impl/Types.hpp"
+#include "precice/span.hpp"
 #include "utils/IntraComm.hpp"
 #include "utils/assertion.hpp"
 
 namespace precice::impl {
 
+namespace {
+
+/**
+ * @brief Determines the rank with the shortest distance for every watch point.
+ *
+ * The primary rank receives the distances of each secondary rank in one message and broadcasts the result.
+ * Ties are resolved in favor of the lowest rank.
+ */
+std::vector<int> closestRanks(const std::vector<double> &distances)
+{
+  std::vector<int> ranks(distances.size(), 0);
+  if (!utils::IntraComm::isParallel()) {
+    return ranks;
+  }
+
+  auto &com = utils::IntraComm::getCommunication();
+  if (utils::IntraComm::isSecondary()) {
+    com->send(precice::span<const double>{distances}, 0);
+    com->broadcast(precice::span<int>{ranks}, 0);
+    return ranks;
+  }
+
+  std::vector<double> closest = distances;
+  std::vector<double> received(distances.size());
+  for (Rank secondaryRank : utils::IntraComm::allSecondaryRanks()) {
+    com->receive(precice::span<double>{received}, secondaryRank);
+    for (std::size_t i = 0; i < received.size(); ++i) {
+      if (received[i] < closest[i]) {
+        closest[i] = received[i];
+        ranks[i]   = secondaryRank;
+      }
+    }
+  }
+  com->broadcast(precice::span<const int>{ranks});
+  return ranks;
+}
+
+} // namespace
+
 WatchPoint::WatchPoint(
     Eigen::VectorXd    pointCoords,
     mesh::PtrMesh      meshToWatch,
     const std::string &exportFilename)
     : _point(std::move(pointCoords)),
       _mesh(std::move(meshToWatch)),
-      _txtWriter(exportFilename)
+      _txtWriter(exportFilename, false)
 {
   PRECICE_ASSERT(_mesh);
   PRECICE_ASSERT(_point.size() == _mesh->getDimensions(), _point.size(),
@@ -56,36 +97,37 @@ const mesh::PtrMesh &WatchPoint::mesh() const
 void WatchPoint::initialize()
 {
   PRECICE_TRACE();
+  locate();
+  _isClosest = closestRanks({_shortestDistance}).front() == utils::IntraComm::getRank();
+  PRECICE_DEBUG("Rank: {}, isClosest: {}", utils::IntraComm::getRank(), _isClosest);
+}
 
-  if (_mesh->nVertices() > 0) {
-    auto match        = _mesh->index().findCellOrProjection(_point, 4);
-    _shortestDistance = match.polation.distance();
-    _interpolation    = std::make_unique<mapping::Polation>(std::move(match.polation));
+void WatchPoint::initialize(const std::vector<PtrWatchPoint> &watchPoints)
+{
+  if (watchPoints.empty()) {
+    return;
   }
 
-  if (utils::IntraComm::isSecondary()) {
-    utils::IntraComm::getCommunication()->send(_shortestDistance, 0);
-    utils::IntraComm::getCommunication()->receive(_isClosest, 0);
+  std::vector<double> distances;
+  distances.reserve(watchPoints.size());
+  for (const auto &watchPoint : watchPoints) {
+    watchPoint->locate();
+    distances.push_back(watchPoint->_shortestDistance);
   }
 
-  if (utils::IntraComm::isPrimary()) {
-    int    closestRank           = 0;
-    double closestDistanceGlobal = _shortestDistance;
-    double closestDistanceLocal  = std::numeric_limits<double>::max();
-    for (Rank secondaryRank : utils::IntraComm::allSecondaryRanks()) {
-      utils::IntraComm::getCommunication()->receive(closestDistanceLocal, secondaryRank);
-      if (closestDistanceLocal < closestDistanceGlobal) {
-        closestDistanceGlobal = closestDistanceLocal;
-        closestRank           = secondaryRank;
-      }
-    }
-    _isClosest = closestRank == 0;
-    for (Rank secondaryRank : utils::IntraComm::allSecondaryRanks()) {
-      utils::IntraComm::getCommunication()->send(closestRank == secondaryRank, secondaryRank);
-    }
+  const auto ranks = closestRanks(distances);
+  for (std::size_t i = 0; i < watchPoints.size(); ++i) {
+    watchPoints[i]->_isClosest = ranks[i] == utils::IntraComm::getRank();
   }
+}
 
-  PRECICE_DEBUG("Rank: {}, isClosest: {}", utils::IntraComm::getRank(), _isClosest);
+void WatchPoint::locate()
+{
+  if (_mesh->nVertices() > 0) {
+    auto match        = _mesh->index().findCellOrProjection(_point, 4);
+    _shortestDistance = match.polation.distance();
+    _interpolation    = std::make_unique<mapping::Polation>(std::move(match.polation));
+  }
 }
 
 void WatchPoint::exportPointData(
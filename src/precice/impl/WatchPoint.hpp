@@ -42,6 +42,13 @@ public:
    */
   void initialize();
 
+  /** Initializes several watch points at once.
+   *
+   * In parallel, the closest ranks of all watch points are determined in a single exchange.
+   * All ranks have to pass the same watch points in the same order.
+   */
+  static void initialize(const std::vector<PtrWatchPoint> &watchPoints);
+
   /// Writes one line with data of the watchpoint into the output file.
   void exportPointData(double time);
 
@@ -68,6 +75,9 @@ private:
   /// Holds the information if this processor is the closest
   bool _isClosest = true;
 
+  /// Finds the closest element on the local part of the mesh
+  void locate();
+
   void getValue(
       Eigen::VectorXd &value,
       mesh::PtrData &  data);
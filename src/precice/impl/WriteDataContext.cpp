@@ -1,5 +1,7 @@
 #include "WriteDataContext.hpp"
 
+#include <utility>
+
 #include "utils/EigenHelperFunctions.hpp"
 
 namespace precice::impl {
@@ -99,9 +101,19 @@ void WriteDataContext::resizeBufferTo(int nVertices)
   }
 }
 
+::precice::span<double> WriteDataContext::writeBuffer()
+{
+  return {_writeDataBuffer.values.data(), static_cast<std::size_t>(_writeDataBuffer.values.size())};
+}
+
 void WriteDataContext::storeBufferedData(double currentTime)
 {
-  _providedData->setSampleAtTime(currentTime, _writeDataBuffer);
+  auto sample = _providedData->timeStepsStorage().acquireSample(_writeDataBuffer.dataDims,
+                                                                _writeDataBuffer.values.size(),
+                                                                _writeDataBuffer.gradients.rows(),
+                                                                _writeDataBuffer.gradients.cols());
+  std::swap(sample, _writeDataBuffer);
+  _providedData->setSampleAtTime(currentTime, std::move(sample));
 }
 
 void WriteDataContext::appendMappingConfiguration(MappingContext &mappingContext, const MeshContext &meshContext)
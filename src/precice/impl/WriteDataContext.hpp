@@ -54,9 +54,19 @@ public:
 
   void resizeBufferTo(int size);
 
+  /**
+   * @brief Provides direct access to the values of _writeDataBuffer
+   *
+   * The view is invalidated by storeBufferedData() and resizeBufferTo().
+   */
+  ::precice::span<double> writeBuffer();
+
   /**
    * @brief Store data from _writeDataBuffer in persistent storage
    *
+   * The buffer is moved into the storage instead of being copied.
+   * This leaves the values of the buffer uninitialized until the next call to resetBuffer().
+   *
    * @param[in] currentTime time data should be associated with
    */
   void storeBufferedData(double currentTime);
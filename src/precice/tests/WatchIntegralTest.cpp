@@ -1218,5 +1218,46 @@ BOOST_AUTO_TEST_CASE(VectorDataFaceConnectivityParallel)
   }
 }
 
+BOOST_AUTO_TEST_CASE(ExportBatchParallel)
+{
+  PRECICE_TEST(""_on(4_ranks).setupIntraComm());
+  using namespace mesh;
+  // Every rank holds one vertex of the first mesh and, except for rank 2, one unit edge of the second mesh
+  PtrMesh vertexMesh(new Mesh("vertices", 2, testing::nextMeshID()));
+  PtrData vertexData = vertexMesh->createData("DoubleData", 1, 0_dataID);
+  vertexMesh->createVertex(Eigen::Vector2d(context.rank, 0.0));
+  vertexData->setSampleAtTime(0, time::Sample(1, Eigen::VectorXd::Constant(1, context.rank + 1.0)));
+
+  PtrMesh edgeMesh(new Mesh("edges", 2, testing::nextMeshID()));
+  PtrData edgeData = edgeMesh->createData("DoubleData", 1, 1_dataID);
+  if (!context.isRank(2)) {
+    mesh::Vertex &v1 = edgeMesh->createVertex(Eigen::Vector2d(context.rank, 0.0));
+    mesh::Vertex &v2 = edgeMesh->createVertex(Eigen::Vector2d(context.rank, 1.0));
+    edgeMesh->createEdge(v1, v2);
+  }
+  edgeData->setSampleAtTime(0, time::Sample(1, Eigen::VectorXd::Constant(edgeMesh->nVertices(), 2.0)));
+
+  std::string vertexFileName("precice-WatchIntegralTest-batch-vertices-parallel.log");
+  std::string edgeFileName("precice-WatchIntegralTest-batch-edges-parallel.log");
+
+  {
+    std::vector<impl::PtrWatchIntegral> watchIntegrals{
+        std::make_shared<impl::WatchIntegral>(vertexMesh, vertexFileName, false),
+        std::make_shared<impl::WatchIntegral>(edgeMesh, edgeFileName, true)};
+    for (auto &watchIntegral : watchIntegrals) {
+      watchIntegral->initialize();
+    }
+    impl::WatchIntegral::exportIntegralData(watchIntegrals, 0.0);
+    impl::WatchIntegral::exportIntegralData(watchIntegrals, 1.0);
+  }
+
+  if (utils::IntraComm::isPrimary()) {
+    // File Format: Time  DoubleData
+    BOOST_TEST(readDoublesFromTXTFile(vertexFileName, 2) == std::vector<double>({0.0, 10.0, 1.0, 10.0}), boost::test_tools::per_element());
+    // File Format: Time  DoubleData SurfaceArea
+    BOOST_TEST(readDoublesFromTXTFile(edgeFileName, 3) == std::vector<double>({0.0, 6.0, 3.0, 1.0, 6.0, 3.0}), boost::test_tools::per_element());
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 BOOST_AUTO_TEST_SUITE_END() // Precice
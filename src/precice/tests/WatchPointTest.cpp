@@ -240,6 +240,26 @@ BOOST_AUTO_TEST_CASE(TimeSeriesWithEdgeParallelPoint2)
   testWatchPoint(context, withEdge, watchPointPosition, expected);
 }
 
+BOOST_AUTO_TEST_CASE(InitializeBatchParallel)
+{
+  PRECICE_TEST(""_on(2_ranks).setupIntraComm(), Require::Events);
+  using namespace mesh;
+  PtrMesh mesh(new Mesh("rectangle", 2, testing::nextMeshID()));
+  const double  offset = context.isPrimary() ? 0.0 : 1.0;
+  mesh::Vertex &v1     = mesh->createVertex(Eigen::Vector2d(0.0, offset));
+  mesh::Vertex &v2     = mesh->createVertex(Eigen::Vector2d(0.0, offset + 1.0));
+  mesh->createEdge(v1, v2);
+
+  // The first point is closest to the edge of the primary rank, the second to the edge of the secondary rank
+  std::vector<impl::PtrWatchPoint> watchPoints{
+      std::make_shared<impl::WatchPoint>(Eigen::Vector2d(-0.5, 0.6), mesh, "precice-WatchPointTest-batch-0.log"),
+      std::make_shared<impl::WatchPoint>(Eigen::Vector2d(0.0, 1.6), mesh, "precice-WatchPointTest-batch-1.log")};
+  impl::WatchPoint::initialize(watchPoints);
+
+  BOOST_TEST(watchPoints[0]->isClosest() == context.isPrimary());
+  BOOST_TEST(watchPoints[1]->isClosest() != context.isPrimary());
+}
+
 BOOST_AUTO_TEST_CASE(Reinitialize)
 {
   PRECICE_TEST(1_rank);
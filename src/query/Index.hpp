@@ -65,6 +65,16 @@ struct ProjectionMatch {
 class Index {
 
 public:
+  /// Spatial data structures available for vertex queries
+  enum class VertexBackend {
+    /// Uses the grid for radius and box queries on large quasi-uniform point clouds, the R-tree otherwise
+    Automatic,
+    /// Always uses the R-tree
+    RTree,
+    /// Uses the grid for radius, box and closest vertex queries
+    Grid
+  };
+
   Index(mesh::PtrMesh mesh);
   Index(mesh::Mesh &mesh);
   ~Index();
@@ -113,6 +123,9 @@ public:
   /// Clear the index
   void clear();
 
+  /// Selects the data structure used for vertex queries
+  void setVertexBackend(VertexBackend backend);
+
 private:
   class IndexImpl;
   std::unique_ptr<IndexImpl> _pimpl;
@@ -120,6 +133,11 @@ private:
   /// The indexed Mesh.
   mesh::Mesh *_mesh;
 
+  VertexBackend _vertexBackend = VertexBackend::Automatic;
+
+  /// Returns true if radius and box queries should use the vertex grid
+  bool useVertexGrid();
+
   static precice::logging::Logger _log;
 
   /// Closest vertex projection element is always the nearest neighbor
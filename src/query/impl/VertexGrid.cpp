@@ -0,0 +1,288 @@
+#include "query/impl/VertexGrid.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+
+#include "mesh/Mesh.hpp"
+#include "utils/assertion.hpp"
+
+namespace precice::query::impl {
+
+namespace {
+/// The average amount of vertices per cell the grid aims for
+constexpr double targetVerticesPerCell = 2.0;
+
+/// Axes with an extent below this fraction of the bounding box diagonal are not divided into cells
+constexpr double degenerateTolerance = 1e-6;
+
+double squaredDistance(const mesh::Vertex::RawCoords &a, const mesh::Vertex::RawCoords &b)
+{
+  double sum = 0;
+  for (int d = 0; d < 3; ++d) {
+    const double diff = a[d] - b[d];
+    sum += diff * diff;
+  }
+  return sum;
+}
+
+mesh::Vertex::RawCoords toRawCoords(const Eigen::VectorXd &location)
+{
+  mesh::Vertex::RawCoords raw{0, 0, 0};
+  std::copy_n(location.data(), location.size(), raw.begin());
+  return raw;
+}
+} // namespace
+
+VertexGrid::VertexGrid(const mesh::Mesh &mesh)
+{
+  const auto &vertices  = mesh.vertices();
+  const auto  nVertices = vertices.size();
+
+  if (nVertices == 0) {
+    _cellStart = {0, 0};
+    return;
+  }
+
+  // Compute the bounding box of the vertices
+  mesh::Vertex::RawCoords lower = vertices.front().rawCoords();
+  mesh::Vertex::RawCoords upper = lower;
+  for (const auto &v : vertices) {
+    const auto &coords = v.rawCoords();
+    for (int d = 0; d < 3; ++d) {
+      lower[d] = std::min(lower[d], coords[d]);
+      upper[d] = std::max(upper[d], coords[d]);
+    }
+  }
+  _origin = lower;
+
+  // Axes with a negligible extent compared to the bounding box are degenerate, e.g., for a flat surface in 3D
+  double diagonal = 0;
+  for (int d = 0; d < 3; ++d) {
+    diagonal += (upper[d] - lower[d]) * (upper[d] - lower[d]);
+  }
+  diagonal = std::sqrt(diagonal);
+  std::array<bool, 3> spanned{};
+  for (int d = 0; d < 3; ++d) {
+    spanned[d] = upper[d] - lower[d] > degenerateTolerance * diagonal;
+  }
+
+  // Derive the cell size from the measure spanned by non-degenerate axes
+  double measure       = 1.0;
+  int    effectiveDims = 0;
+  for (int d = 0; d < 3; ++d) {
+    if (spanned[d]) {
+      measure *= upper[d] - lower[d];
+      ++effectiveDims;
+    }
+  }
+  if (effectiveDims > 0) {
+    _cellSize = std::pow(measure * targetVerticesPerCell / nVertices, 1.0 / effectiveDims);
+  }
+
+  // Thin axes lead to many empty cells, hence, enlarge the cells until there are at most as many cells as vertices.
+  // Cells are counted in floating point, as thin axes may lead to more cells than integers can represent.
+  const auto            maxCells = static_cast<double>(nVertices);
+  std::array<double, 3> nCells{1, 1, 1};
+  while (true) {
+    double nCellsTotal = 1.0;
+    for (int d = 0; d < 3; ++d) {
+      nCells[d] = spanned[d] ? std::max(1.0, std::ceil((upper[d] - lower[d]) / _cellSize)) : 1.0;
+      nCellsTotal *= nCells[d];
+    }
+    if (nCellsTotal <= maxCells) {
+      break;
+    }
+    // Grow by at least one percent to guarantee progress despite rounding up the cell counts
+    _cellSize *= std::max(std::pow(nCellsTotal / maxCells, 1.0 / effectiveDims), 1.01);
+  }
+  for (int d = 0; d < 3; ++d) {
+    _nCells[d] = static_cast<int>(nCells[d]);
+  }
+
+  // Bin the vertices using a counting sort
+  const std::int64_t nCellsTotal = static_cast<std::int64_t>(_nCells[0]) * _nCells[1] * _nCells[2];
+  std::vector<int>   cellOfVertex(nVertices);
+  _cellStart.assign(nCellsTotal + 1, 0);
+  for (std::size_t i = 0; i < nVertices; ++i) {
+    cellOfVertex[i] = linearize(cellOf(vertices[i].rawCoords()));
+    ++_cellStart[cellOfVertex[i] + 1];
+  }
+  std::partial_sum(_cellStart.begin(), _cellStart.end(), _cellStart.begin());
+
+  _ids.resize(nVertices);
+  _coords.resize(nVertices);
+  std::vector<int> fill(_cellStart.begin(), _cellStart.end() - 1);
+  for (std::size_t i = 0; i < nVertices; ++i) {
+    const auto position = fill[cellOfVertex[i]]++;
+    _ids[position]      = vertices[i].getID();
+    _coords[position]   = vertices[i].rawCoords();
+  }
+}
+
+int VertexGrid::cellOf(double coord, int axis) const
+{
+  if (_nCells[axis] == 1) {
+    return 0;
+  }
+  // Clamp in floating point to handle coordinates far outside of the grid
+  const double cell = std::floor((coord - _origin[axis]) / _cellSize);
+  return static_cast<int>(std::clamp(cell, 0.0, static_cast<double>(_nCells[axis] - 1)));
+}
+
+VertexGrid::CellIndex VertexGrid::cellOf(const mesh::Vertex::RawCoords &location) const
+{
+  return {cellOf(location[0], 0), cellOf(location[1], 1), cellOf(location[2], 2)};
+}
+
+int VertexGrid::linearize(const CellIndex &cell) const
+{
+  return cell[0] + _nCells[0] * (cell[1] + _nCells[1] * cell[2]);
+}
+
+template <typename Visitor>
+void VertexGrid::visitCells(const CellIndex &lower, const CellIndex &upper, Visitor &&visitor) const
+{
+  for (int z = lower[2]; z <= upper[2]; ++z) {
+    for (int y = lower[1]; y <= upper[1]; ++y) {
+      // Cells along x are contiguous, hence their vertices form a single range
+      const int first = _cellStart[linearize({lower[0], y, z})];
+      const int last  = _cellStart[linearize({upper[0], y, z}) + 1];
+      for (int position = first; position < last; ++position) {
+        if (visitor(position)) {
+          return;
+        }
+      }
+    }
+  }
+}
+
+std::vector<VertexID> VertexGrid::getVerticesInsideSphere(const mesh::Vertex::RawCoords &center, double radius) const
+{
+  std::vector<VertexID> matches;
+  if (_ids.empty()) {
+    return matches;
+  }
+
+  CellIndex lower, upper;
+  for (int d = 0; d < 3; ++d) {
+    lower[d] = cellOf(center[d] - radius, d);
+    upper[d] = cellOf(center[d] + radius, d);
+  }
+
+  visitCells(lower, upper, [&](int position) {
+    if (std::sqrt(squaredDistance(center, _coords[position])) < radius) {
+      matches.push_back(_ids[position]);
+    }
+    return false;
+  });
+  std::sort(matches.begin(), matches.end());
+  return matches;
+}
+
+bool VertexGrid::isAnyVertexInsideSphere(const mesh::Vertex::RawCoords &center, double radius) const
+{
+  if (_ids.empty()) {
+    return false;
+  }
+
+  CellIndex lower, upper;
+  for (int d = 0; d < 3; ++d) {
+    lower[d] = cellOf(center[d] - radius, d);
+    upper[d] = cellOf(center[d] + radius, d);
+  }
+
+  bool found = false;
+  visitCells(lower, upper, [&](int position) {
+    found = std::sqrt(squaredDistance(center, _coords[position])) < radius;
+    return found;
+  });
+  return found;
+}
+
+std::vector<VertexID> VertexGrid::getVerticesInsideBox(const mesh::BoundingBox &bb) const
+{
+  std::vector<VertexID> matches;
+  if (_ids.empty() || bb.isDefault()) {
+    return matches;
+  }
+
+  const auto boxMin = toRawCoords(bb.minCorner());
+  const auto boxMax = toRawCoords(bb.maxCorner());
+  visitCells(cellOf(boxMin), cellOf(boxMax), [&](int position) {
+    const auto &coords = _coords[position];
+    for (int d = 0; d < 3; ++d) {
+      if (coords[d] < boxMin[d] || coords[d] > boxMax[d]) {
+        return false;
+      }
+    }
+    matches.push_back(_ids[position]);
+    return false;
+  });
+  std::sort(matches.begin(), matches.end());
+  return matches;
+}
+
+VertexID VertexGrid::getClosestVertex(const Eigen::VectorXd &location) const
+{
+  PRECICE_ASSERT(!_ids.empty());
+  const auto      point  = toRawCoords(location);
+  const CellIndex center = cellOf(point);
+
+  int maxRing = 0;
+  for (int d = 0; d < 3; ++d) {
+    maxRing = std::max({maxRing, center[d], _nCells[d] - 1 - center[d]});
+  }
+
+  VertexID bestID       = -1;
+  double   bestDistance = std::numeric_limits<double>::max();
+  for (int ring = 0; ring <= maxRing; ++ring) {
+    // Visit the shell of cells with a Chebyshev distance of ring to the center cell
+    for (int z = std::max(center[2] - ring, 0); z <= std::min(center[2] + ring, _nCells[2] - 1); ++z) {
+      for (int y = std::max(center[1] - ring, 0); y <= std::min(center[1] + ring, _nCells[1] - 1); ++y) {
+        const bool onShell = std::abs(z - center[2]) == ring || std::abs(y - center[1]) == ring;
+        const int  step    = onShell ? 1 : 2 * ring;
+        for (int x = center[0] - ring; x <= center[0] + ring; x += std::max(step, 1)) {
+          if (x < 0 || x >= _nCells[0]) {
+            continue;
+          }
+          const int cell = linearize({x, y, z});
+          for (int position = _cellStart[cell]; position < _cellStart[cell + 1]; ++position) {
+            const double distance = std::sqrt(squaredDistance(point, _coords[position]));
+            if (distance < bestDistance || (distance == bestDistance && _ids[position] < bestID)) {
+              bestDistance = distance;
+              bestID       = _ids[position];
+            }
+          }
+        }
+      }
+    }
+    // All unvisited cells are at least ring cells away from the location
+    if (bestID != -1 && bestDistance <= ring * _cellSize) {
+      break;
+    }
+  }
+  return bestID;
+}
+
+bool VertexGrid::isQuasiUniform() const
+{
+  if (_ids.empty()) {
+    return false;
+  }
+  const int nCellsTotal = static_cast<int>(_cellStart.size()) - 1;
+  int       occupied    = 0;
+  int       maxCount    = 0;
+  for (int cell = 0; cell < nCellsTotal; ++cell) {
+    const int count = _cellStart[cell + 1] - _cellStart[cell];
+    occupied += (count > 0);
+    maxCount = std::max(maxCount, count);
+  }
+  const double averageCount = static_cast<double>(_ids.size()) / occupied;
+  return 2 * occupied >= nCellsTotal && maxCount <= 8 * averageCount;
+}
+
+} // namespace precice::query::impl
@@ -0,0 +1,106 @@
+#pragma once
+
+#include <Eigen/Core>
+#include <array>
+#include <vector>
+
+#include "mesh/BoundingBox.hpp"
+#include "mesh/Vertex.hpp"
+#include "precice/impl/Types.hpp"
+
+namespace precice {
+namespace mesh {
+class Mesh;
+} // namespace mesh
+
+namespace query {
+namespace impl {
+
+/**
+ * @brief Uniform grid of the vertices of a mesh, stored as contiguous cell arrays.
+ *
+ * The vertices are binned into cells of equal size, where the vertices of each cell
+ * are stored contiguously, similar to a CSR matrix. Coordinates are stored in the same
+ * order, which makes radius queries on quasi-uniform point clouds cache friendly.
+ *
+ * The grid is a snapshot of the mesh and needs to be rebuilt if the mesh changes.
+ */
+class VertexGrid {
+public:
+  /// Builds the grid for all vertices of the given mesh
+  explicit VertexGrid(const mesh::Mesh &mesh);
+
+  /// Returns the IDs of all vertices with a distance smaller than radius to center in ascending order
+  std::vector<VertexID> getVerticesInsideSphere(const mesh::Vertex::RawCoords &center, double radius) const;
+
+  /// Returns true if any vertex has a distance smaller than radius to center
+  bool isAnyVertexInsideSphere(const mesh::Vertex::RawCoords &center, double radius) const;
+
+  /// Returns the IDs of all vertices inside the given bounding box (boundary inclusive) in ascending order
+  std::vector<VertexID> getVerticesInsideBox(const mesh::BoundingBox &bb) const;
+
+  /// Returns the ID of the closest vertex to the given location
+  VertexID getClosestVertex(const Eigen::VectorXd &location) const;
+
+  /**
+   * @brief Returns true if the vertices are distributed evenly over the cells.
+   *
+   * This is the case for quasi-uniform volumetric point clouds, but not for
+   * surfaces embedded in a higher-dimensional space or for strongly graded meshes.
+   */
+  bool isQuasiUniform() const;
+
+  /// Returns the amount of indexed vertices
+  std::size_t size() const
+  {
+    return _ids.size();
+  }
+
+  /// Returns the amount of cells, which does not exceed the amount of vertices
+  std::size_t nCells() const
+  {
+    return _cellStart.size() - 1;
+  }
+
+private:
+  using CellIndex = std::array<int, 3>;
+
+  /// Lower corner of the grid
+  mesh::Vertex::RawCoords _origin{};
+
+  /// Edge length of every cell
+  double _cellSize = 1.0;
+
+  /// Amount of cells per dimension, unused dimensions have a single cell
+  CellIndex _nCells{1, 1, 1};
+
+  /// Offsets of the first vertex for each cell, contains one additional entry
+  std::vector<int> _cellStart;
+
+  /// Vertex IDs ordered by cell
+  std::vector<VertexID> _ids;
+
+  /// Vertex coordinates ordered by cell
+  std::vector<mesh::Vertex::RawCoords> _coords;
+
+  /// Returns the cell containing the location, clamped to the grid
+  CellIndex cellOf(const mesh::Vertex::RawCoords &location) const;
+
+  /// Returns the cell containing the location along a single axis, clamped to the grid
+  int cellOf(double coord, int axis) const;
+
+  /// Returns the linear index of the given cell
+  int linearize(const CellIndex &cell) const;
+
+  /**
+   * @brief Visits all vertices in the cells between lower and upper (inclusive)
+   *
+   * The visitor receives the position of the vertex in the cell arrays and returns true to stop visiting.
+   */
+  template <typename Visitor>
+  void visitCells(const CellIndex &lower, const CellIndex &upper, Visitor &&visitor) const;
+};
+
+} // namespace impl
+} // namespace query
+} // namespace precice
@@ -213,6 +213,26 @@ BOOST_AUTO_TEST_CASE(QueryWithBoxEverything)
   BOOST_TEST(results.size() == 8);
 }
 
+BOOST_AUTO_TEST_CASE(RebuildOnMeshRevision)
+{
+  PRECICE_TEST(1_rank);
+  auto  mesh  = vertexMesh3D();
+  auto &index = mesh->index();
+
+  mesh::Vertex searchVertex(Eigen::Vector3d(2, 2, 2), 0);
+  BOOST_TEST(!index.isAnyVertexInsideBox(searchVertex, 0.5));
+  const auto revision = mesh->getRevision();
+
+  // Querying again doesn't modify the mesh
+  BOOST_TEST(!index.isAnyVertexInsideBox(searchVertex, 0.5));
+  BOOST_TEST(mesh->getRevision() == revision);
+
+  // Adding a vertex outdates the cached tree
+  mesh->createVertex(Eigen::Vector3d(2, 2, 2.1));
+  BOOST_TEST(mesh->getRevision() != revision);
+  BOOST_TEST(index.isAnyVertexInsideBox(searchVertex, 0.5));
+}
+
 BOOST_AUTO_TEST_CASE(QueryRtreeBoundingBox2D)
 {
   PRECICE_TEST(1_rank);
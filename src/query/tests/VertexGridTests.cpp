@@ -0,0 +1,150 @@
+#include <Eigen/Core>
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "mesh/BoundingBox.hpp"
+#include "mesh/Mesh.hpp"
+#include "mesh/SharedPointer.hpp"
+#include "mesh/Vertex.hpp"
+#include "query/Index.hpp"
+#include "query/impl/VertexGrid.hpp"
+#include "testing/TestContext.hpp"
+#include "testing/Testing.hpp"
+
+using namespace precice;
+using namespace precice::mesh;
+using namespace precice::query;
+
+namespace {
+PtrMesh randomMesh(int dimensions, int nVertices)
+{
+  PtrMesh                                mesh(new Mesh("MyMesh", dimensions, testing::nextMeshID()));
+  std::mt19937                           generator(42);
+  std::uniform_real_distribution<double> distribution(-1.0, 2.0);
+  Eigen::VectorXd                        coords(dimensions);
+  for (int i = 0; i < nVertices; ++i) {
+    for (int d = 0; d < dimensions; ++d) {
+      coords[d] = distribution(generator);
+    }
+    mesh->createVertex(coords);
+  }
+  return mesh;
+}
+
+std::vector<VertexID> sorted(std::vector<VertexID> ids)
+{
+  std::sort(ids.begin(), ids.end());
+  return ids;
+}
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(QueryTests)
+BOOST_AUTO_TEST_SUITE(VertexGridTests)
+
+BOOST_AUTO_TEST_CASE(MatchesRTree)
+{
+  PRECICE_TEST(1_rank);
+  for (int dim : {2, 3}) {
+    auto  mesh = randomMesh(dim, 2000);
+    Index rtree(mesh);
+    rtree.setVertexBackend(Index::VertexBackend::RTree);
+    Index grid(mesh);
+    grid.setVertexBackend(Index::VertexBackend::Grid);
+
+    auto probes = randomMesh(dim, 50);
+    for (const auto &probe : probes->vertices()) {
+      for (double radius : {0.01, 0.1, 0.5, 5.0}) {
+        BOOST_TEST(sorted(rtree.getVerticesInsideBox(probe, radius)) == grid.getVerticesInsideBox(probe, radius));
+        BOOST_TEST(rtree.isAnyVertexInsideBox(probe, radius) == grid.isAnyVertexInsideBox(probe, radius));
+      }
+      const auto closestRTree = rtree.getClosestVertex(probe.getCoords()).index;
+      const auto closestGrid  = grid.getClosestVertex(probe.getCoords()).index;
+      BOOST_TEST((mesh->vertex(closestRTree).getCoords() - probe.getCoords()).norm() ==
+                 (mesh->vertex(closestGrid).getCoords() - probe.getCoords()).norm());
+
+      BoundingBox bb((probe.getCoords().array() - 0.2).matrix(), (probe.getCoords().array() + 0.3).matrix());
+      BOOST_TEST(sorted(rtree.getVerticesInsideBox(bb)) == grid.getVerticesInsideBox(bb));
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(ClosestOutsideOfGrid)
+{
+  PRECICE_TEST(1_rank);
+  auto  mesh = randomMesh(3, 500);
+  Index rtree(mesh);
+  rtree.setVertexBackend(Index::VertexBackend::RTree);
+  Index grid(mesh);
+  grid.setVertexBackend(Index::VertexBackend::Grid);
+
+  for (const Eigen::Vector3d &location : {Eigen::Vector3d(-10, 0, 0), Eigen::Vector3d(5, 5, 5), Eigen::Vector3d(0.5, 0.5, 100)}) {
+    BOOST_TEST(rtree.getClosestVertex(location).index == grid.getClosestVertex(location).index);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(Uniformity)
+{
+  PRECICE_TEST(1_rank);
+  {
+    auto mesh = randomMesh(3, 5000);
+    BOOST_TEST(impl::VertexGrid(*mesh).isQuasiUniform());
+  }
+  {
+    // Vertices on a sphere only occupy a fraction of the cells
+    Mesh mesh("Sphere", 3, testing::nextMeshID());
+    for (int i = 0; i < 100; ++i) {
+      for (int j = 0; j < 100; ++j) {
+        const double theta = M_PI * i / 99;
+        const double phi   = 2 * M_PI * j / 100;
+        mesh.createVertex(Eigen::Vector3d(std::sin(theta) * std::cos(phi), std::sin(theta) * std::sin(phi), std::cos(theta)));
+      }
+    }
+    BOOST_TEST(!impl::VertexGrid(mesh).isQuasiUniform());
+  }
+}
+
+BOOST_AUTO_TEST_CASE(AutomaticNearlyFlat)
+{
+  PRECICE_TEST(1_rank);
+  // Enough vertices to consider the grid for the automatic backend
+  constexpr int nVertices = 12000;
+
+  // Perturb a random plane by a thickness, which is resolved in the first case and negligible in the others
+  for (double thickness : {1e-4, 1e-9, 0.0}) {
+    BOOST_TEST_CONTEXT("thickness = " << thickness)
+    {
+      auto                                   mesh = randomMesh(2, nVertices);
+      PtrMesh                                flat(new Mesh("Flat", 3, testing::nextMeshID()));
+      std::mt19937                           generator(7);
+      std::uniform_real_distribution<double> distribution(0.0, thickness);
+      for (const auto &vertex : mesh->vertices()) {
+        flat->createVertex(Eigen::Vector3d(vertex.coord(0), vertex.coord(1), distribution(generator)));
+      }
+
+      impl::VertexGrid vertexGrid(*flat);
+      BOOST_TEST(vertexGrid.nCells() <= static_cast<std::size_t>(nVertices));
+      BOOST_TEST(vertexGrid.isQuasiUniform());
+
+      Index rtree(flat);
+      rtree.setVertexBackend(Index::VertexBackend::RTree);
+      Index automatic(flat);
+
+      auto probes = randomMesh(2, 20);
+      for (const auto &probe : probes->vertices()) {
+        const Eigen::Vector3d location(probe.coord(0), probe.coord(1), 0.0);
+        Vertex                center(location, -1);
+        for (double radius : {0.01, 0.1}) {
+          BOOST_TEST(sorted(rtree.getVerticesInsideBox(center, radius)) == sorted(automatic.getVerticesInsideBox(center, radius)));
+        }
+        const auto closestRTree     = rtree.getClosestVertex(location).index;
+        const auto closestAutomatic = automatic.getClosestVertex(location).index;
+        BOOST_TEST((flat->vertex(closestRTree).getCoords() - location).norm() ==
+                   (flat->vertex(closestAutomatic).getCoords() - location).norm());
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END() // VertexGridTests
+BOOST_AUTO_TEST_SUITE_END() // QueryTests
@@ -21,6 +21,8 @@ target_sources(preciceCore
     src/acceleration/SharedPointer.hpp
     src/acceleration/config/AccelerationConfiguration.cpp
     src/acceleration/config/AccelerationConfiguration.hpp
+    src/acceleration/impl/BinaryState.cpp
+    src/acceleration/impl/BinaryState.hpp
     src/acceleration/impl/ConstantPreconditioner.cpp
     src/acceleration/impl/ConstantPreconditioner.hpp
     src/acceleration/impl/ParallelMatrixOperations.cpp
@@ -122,6 +124,8 @@ target_sources(preciceCore
     src/cplscheme/impl/ResidualRelativeConvergenceMeasure.cpp
     src/cplscheme/impl/ResidualRelativeConvergenceMeasure.hpp
     src/cplscheme/impl/SharedPointer.hpp
+    src/cplscheme/impl/SubstepReduction.cpp
+    src/cplscheme/impl/SubstepReduction.hpp
     src/cplscheme/impl/TimeHandler.cpp
     src/cplscheme/impl/TimeHandler.hpp
     src/io/Export.cpp
@@ -178,6 +182,7 @@ target_sources(preciceCore
     src/mapping/BarycentricBaseMapping.hpp
     src/mapping/GinkgoDefinitions.hpp
     src/mapping/GinkgoRadialBasisFctSolver.hpp
+    src/mapping/HMatrixRadialBasisFctSolver.hpp
     src/mapping/LinearCellInterpolationMapping.cpp
     src/mapping/LinearCellInterpolationMapping.hpp
     src/mapping/Mapping.cpp
@@ -206,6 +211,10 @@ target_sources(preciceCore
     src/mapping/config/MappingConfigurationTypes.hpp
     src/mapping/impl/BasisFunctions.hpp
     src/mapping/impl/CreateClustering.hpp
+    src/mapping/impl/GMRES.cpp
+    src/mapping/impl/GMRES.hpp
+    src/mapping/impl/HierarchicalMatrix.cpp
+    src/mapping/impl/HierarchicalMatrix.hpp
     src/mapping/impl/SphericalVertexCluster.hpp
     src/math/Bspline.cpp
     src/math/Bspline.hpp
@@ -289,6 +298,8 @@ target_sources(preciceCore
     src/query/Index.cpp
     src/query/Index.hpp
     src/query/impl/RTreeAdapter.hpp
+    src/query/impl/VertexGrid.cpp
+    src/query/impl/VertexGrid.hpp
     src/time/Sample.hpp
     src/time/Stample.hpp
     src/time/Storage.cpp
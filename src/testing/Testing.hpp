@@ -96,6 +96,9 @@ boost::test_tools::predicate_result equals(float a, float b, float tolerance = m
 
 boost::test_tools::predicate_result equals(double a, double b, double tolerance = math::NUMERICAL_ZERO_DIFFERENCE);
 
+/// Configures the logging of the test suite, which locks the logging configuration.
+void setupTestLogging();
+
 /// Returns the base path of the repo.
 std::string getPathToRepository();
 
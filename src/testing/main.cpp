@@ -9,9 +9,11 @@
 #include <boost/test/tree/traverse.hpp>
 #include <boost/test/unit_test.hpp>
 
+#include <algorithm>
 #include <filesystem>
 #include <iostream>
 #include <string>
+#include <string_view>
 
 #include "com/SharedPointer.hpp"
 #include "logging/LogConfiguration.hpp"
@@ -84,13 +86,27 @@ void removeStaleRunDirectory()
   }
 }
 
+/// Removes the given flag from the arguments and returns whether it was present
+bool extractFlag(int &argc, char *argv[], std::string_view flag)
+{
+  auto end = std::remove_if(argv + 1, argv + argc, [flag](const char *arg) { return arg == flag; });
+  if (end == argv + argc) {
+    return false;
+  }
+  argc       = static_cast<int>(end - argv);
+  argv[argc] = nullptr;
+  return true;
+}
+
 /// Entry point for the boost test executable
 int main(int argc, char *argv[])
 {
   using namespace precice;
 
   precice::syncMode = false;
-  utils::Parallel::initializeTestingMPI(&argc, &argv);
+  // Tests of the asynchronous advance require MPI_THREAD_MULTIPLE, which is not requested by default
+  const bool threadMultiple = extractFlag(argc, argv, "--mpi-thread-multiple");
+  utils::Parallel::initializeTestingMPI(&argc, &argv, threadMultiple);
   const auto rank = utils::Parallel::current()->rank();
   const auto size = utils::Parallel::current()->size();
   logging::setMPIRank(rank);
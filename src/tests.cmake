@@ -32,6 +32,7 @@ target_sources(testprecice
     src/cplscheme/tests/RelativeConvergenceMeasureTest.cpp
     src/cplscheme/tests/ResidualRelativeConvergenceMeasureTest.cpp
     src/cplscheme/tests/SerialImplicitCouplingSchemeTest.cpp
+    src/cplscheme/tests/SubstepReductionTest.cpp
     src/cplscheme/tests/TimeHandlerTests.cpp
     src/io/tests/ExportCSVTest.cpp
     src/io/tests/ExportConfigurationTest.cpp
@@ -40,10 +41,12 @@ target_sources(testprecice
     src/io/tests/ExportVTUTest.cpp
     src/io/tests/TXTTableWriterTest.cpp
     src/io/tests/TXTWriterReaderTest.cpp
+    src/logging/tests/LoggerTest.cpp
     src/m2n/tests/GatherScatterCommunicationTest.cpp
     src/m2n/tests/PointToPointCommunicationTest.cpp
     src/mapping/tests/AxialGeoMultiscaleMappingTest.cpp
     src/mapping/tests/GinkgoRadialBasisFctSolverTest.cpp
+    src/mapping/tests/HMatrixRadialBasisFctSolverTest.cpp
     src/mapping/tests/LinearCellInterpolationMappingTest.cpp
     src/mapping/tests/MappingConfigurationTest.cpp
     src/mapping/tests/NearestNeighborGradientMappingTest.cpp
@@ -82,6 +85,7 @@ target_sources(testprecice
     src/precice/tests/WatchPointTest.cpp
     src/query/tests/RTreeAdapterTests.cpp
     src/query/tests/RTreeTests.cpp
+    src/query/tests/VertexGridTests.cpp
     src/testing/DataContextFixture.cpp
     src/testing/DataContextFixture.hpp
     src/testing/GlobalFixtures.cpp
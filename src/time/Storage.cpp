@@ -1,4 +1,6 @@
+#include <algorithm>
 #include <boost/range.hpp>
+#include <utility>
 
 #include "cplscheme/CouplingScheme.hpp"
 #include "math/Bspline.hpp"
@@ -25,12 +27,20 @@ Storage &Storage::operator=(const Storage &other)
 }
 
 void Storage::setSampleAtTime(double time, const Sample &sample)
+{
+  Sample copy    = acquireSample(sample.dataDims, sample.values.size(), sample.gradients.rows(), sample.gradients.cols());
+  copy.values    = sample.values;
+  copy.gradients = sample.gradients;
+  setSampleAtTime(time, std::move(copy));
+}
+
+void Storage::setSampleAtTime(double time, Sample &&sample)
 {
   // The spline has to be recomputed, since the underlying data has changed
   _bspline.reset();
 
   if (_stampleStorage.empty()) {
-    _stampleStorage.emplace_back(Stample{time, sample});
+    _stampleStorage.emplace_back(Stample{time, std::move(sample)});
     return;
   }
 
@@ -42,13 +52,34 @@ void Storage::setSampleAtTime(double time, const Sample &sample)
   auto existingSample = std::find_if(_stampleStorage.begin(), _stampleStorage.end(), [&time](const auto &s) { return math::equals(s.timestamp, time); });
   if (existingSample == _stampleStorage.end()) { // key does not exist yet
     PRECICE_ASSERT(math::smaller(maxStoredTime(), time), maxStoredTime(), time, "Trying to write sample with a time that is too small. Please use clear(), if you want to write new samples to the storage.");
-    _stampleStorage.emplace_back(Stample{time, sample});
+    _stampleStorage.emplace_back(Stample{time, std::move(sample)});
   } else {
     // Overriding sample
-    existingSample->sample = sample;
+    std::swap(existingSample->sample, sample);
+    _recycledSamples.push_back(std::move(sample));
   }
 }
 
+Sample Storage::acquireSample(int dataDims, Eigen::Index nValues, Eigen::Index gradientRows, Eigen::Index gradientCols)
+{
+  if (_recycledSamples.empty()) {
+    return Sample{dataDims, Eigen::VectorXd(nValues), Eigen::MatrixXd(gradientRows, gradientCols)};
+  }
+
+  // Prefer a sample of matching size, as resizing reallocates the buffers
+  auto recycled = std::find_if(_recycledSamples.rbegin(), _recycledSamples.rend(), [nValues](const auto &s) { return s.values.size() == nValues; });
+  if (recycled == _recycledSamples.rend()) {
+    recycled = _recycledSamples.rbegin();
+  }
+  Sample sample = std::move(*recycled);
+  _recycledSamples.erase(std::next(recycled).base());
+
+  sample.dataDims = dataDims;
+  sample.values.resize(nValues);
+  sample.gradients.resize(gradientRows, gradientCols);
+  return sample;
+}
+
 void Storage::setInterpolationDegree(int interpolationDegree)
 {
   PRECICE_ASSERT(interpolationDegree >= Time::MIN_WAVEFORM_DEGREE);
@@ -88,7 +119,7 @@ void Storage::move()
   PRECICE_ASSERT(nTimes() >= 2, "Calling Storage::move() is only allowed, if there is a sample at the beginning and at the end. This ensures that this function is only called at the end of the window.", getTimes());
   PRECICE_ASSERT(!_stampleStorage.empty(), "Storage does not contain any data!");
   const double nextWindowStart = _stampleStorage.back().timestamp;
-  _stampleStorage.erase(_stampleStorage.begin(), --_stampleStorage.end());
+  discard(_stampleStorage.begin(), --_stampleStorage.end());
   PRECICE_ASSERT(nextWindowStart == _stampleStorage.front().timestamp);
 
   // The spline has to be recomputed, since the underlying data has changed
@@ -99,7 +130,7 @@ void Storage::trim()
 {
   PRECICE_ASSERT(!_stampleStorage.empty(), "Storage does not contain any data!");
   const double thisWindowStart = _stampleStorage.front().timestamp;
-  _stampleStorage.erase(++_stampleStorage.begin(), _stampleStorage.end());
+  discard(++_stampleStorage.begin(), _stampleStorage.end());
   PRECICE_ASSERT(_stampleStorage.size() == 1);
   PRECICE_ASSERT(thisWindowStart == _stampleStorage.front().timestamp);
 
@@ -109,7 +140,7 @@ void Storage::trim()
 
 void Storage::clear()
 {
-  _stampleStorage.clear();
+  discard(_stampleStorage.begin(), _stampleStorage.end());
   PRECICE_ASSERT(_stampleStorage.size() == 0);
 
   // The spline has to be recomputed, since the underlying data has changed
@@ -121,7 +152,7 @@ void Storage::clearExceptLast()
   if (_stampleStorage.empty()) {
     return;
   }
-  _stampleStorage.erase(_stampleStorage.begin(), --_stampleStorage.end());
+  discard(_stampleStorage.begin(), --_stampleStorage.end());
 
   // The spline has to be recomputed, since the underlying data has changed
   _bspline.reset();
@@ -129,8 +160,9 @@ void Storage::clearExceptLast()
 
 void Storage::trimBefore(double time)
 {
-  auto beforeTime = [time](const auto &s) { return math::smaller(s.timestamp, time); };
-  _stampleStorage.erase(std::remove_if(_stampleStorage.begin(), _stampleStorage.end(), beforeTime), _stampleStorage.end());
+  // Stamples are sorted by their timestamp
+  auto notBeforeTime = [time](const auto &s) { return math::greaterEquals(s.timestamp, time); };
+  discard(_stampleStorage.begin(), std::find_if(_stampleStorage.begin(), _stampleStorage.end(), notBeforeTime));
 
   // The spline has to be recomputed, since the underlying data has changed
   _bspline.reset();
@@ -138,8 +170,9 @@ void Storage::trimBefore(double time)
 
 void Storage::trimAfter(double time)
 {
+  // Stamples are sorted by their timestamp
   auto afterTime = [time](const auto &s) { return math::greater(s.timestamp, time); };
-  _stampleStorage.erase(std::remove_if(_stampleStorage.begin(), _stampleStorage.end(), afterTime), _stampleStorage.end());
+  discard(std::find_if(_stampleStorage.begin(), _stampleStorage.end(), afterTime), _stampleStorage.end());
 
   // The spline has to be recomputed, since the underlying data has changed
   _bspline.reset();
@@ -253,4 +286,10 @@ int Storage::findTimeId(double time) const
   return -1; // time not found in times
 }
 
+void Storage::discard(std::vector<Stample>::iterator first, std::vector<Stample>::iterator last)
+{
+  std::for_each(first, last, [this](auto &stample) { _recycledSamples.push_back(std::move(stample.sample)); });
+  _stampleStorage.erase(first, last);
+}
+
 } // namespace precice::time
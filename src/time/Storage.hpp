@@ -39,6 +39,23 @@ public:
    */
   void setSampleAtTime(double time, const Sample &sample);
 
+  /// @copydoc setSampleAtTime(double, const Sample &)
+  void setSampleAtTime(double time, Sample &&sample);
+
+  /**
+   * @brief Provides a Sample of the given shape, reusing the buffers of samples previously removed from this Storage.
+   *
+   * Samples removed by move(), trim(), clear() and alike are kept for recycling, which avoids reallocating their buffers in every time window and iteration.
+   * The values and gradients of the returned Sample are uninitialized.
+   *
+   * @param dataDims dimensionality of the data
+   * @param nValues size of the values
+   * @param gradientRows amount of rows of the gradients
+   * @param gradientCols amount of columns of the gradients
+   * @return Sample of the requested shape
+   */
+  Sample acquireSample(int dataDims, Eigen::Index nValues, Eigen::Index gradientRows = 0, Eigen::Index gradientCols = 0);
+
   void setInterpolationDegree(int interpolationDegree);
 
   int getInterpolationDegree() const;
@@ -142,6 +159,9 @@ private:
   /// Stores Stamples on the current window
   std::vector<Stample> _stampleStorage;
 
+  /// Samples removed from _stampleStorage, whose buffers are reused by acquireSample()
+  std::vector<Sample> _recycledSamples;
+
   mutable logging::Logger _log{"time::Storage"};
 
   int _degree;
@@ -165,6 +185,9 @@ private:
   time::Sample getSampleAtEnd();
 
   int findTimeId(double time) const;
+
+  /// Removes the given range of stamples and keeps their samples for recycling
+  void discard(std::vector<Stample>::iterator first, std::vector<Stample>::iterator last);
 };
 
 } // namespace precice::time
@@ -103,6 +103,47 @@ BOOST_AUTO_TEST_CASE(testGetTimesAndValues)
   }
 }
 
+// make sure that buffers of removed samples are reused
+BOOST_AUTO_TEST_CASE(testRecycling)
+{
+  PRECICE_TEST(1_rank);
+  auto storage = Storage();
+  int  nValues = 3;
+  storage.setSampleAtTime(0.0, time::Sample{1, Eigen::VectorXd::Ones(nValues)});
+  storage.setSampleAtTime(0.5, time::Sample{1, 2 * Eigen::VectorXd::Ones(nValues)});
+  storage.setSampleAtTime(1.0, time::Sample{1, 3 * Eigen::VectorXd::Ones(nValues)});
+  const double *windowStart = storage.stamples()[0].sample.values.data();
+  const double *substep     = storage.stamples()[1].sample.values.data();
+
+  storage.move();
+  BOOST_TEST(storage.nTimes() == 1);
+
+  // copies into the storage use the recycled buffers
+  const time::Sample next{1, 4 * Eigen::VectorXd::Ones(nValues)};
+  storage.setSampleAtTime(1.5, next);
+  const double *copied = storage.stamples()[1].sample.values.data();
+  BOOST_TEST((copied == windowStart || copied == substep));
+  BOOST_TEST(storage.stamples()[1].sample.values(0) == 4.0);
+
+  auto sample = storage.acquireSample(1, nValues);
+  BOOST_TEST(sample.values.size() == nValues);
+  BOOST_TEST(sample.gradients.size() == 0);
+  BOOST_TEST((sample.values.data() == windowStart || sample.values.data() == substep));
+  BOOST_TEST(sample.values.data() != copied);
+
+  // no recycled buffers left
+  auto other = storage.acquireSample(2, 2 * nValues, 2, 3);
+  BOOST_TEST(other.dataDims == 2);
+  BOOST_TEST(other.values.size() == 2 * nValues);
+  BOOST_TEST(other.gradients.rows() == 2);
+  BOOST_TEST(other.gradients.cols() == 3);
+
+  // recycled samples are resized if required
+  storage.trim();
+  auto resized = storage.acquireSample(1, 2 * nValues);
+  BOOST_TEST(resized.values.size() == 2 * nValues);
+}
+
 BOOST_AUTO_TEST_SUITE(ExtrapolationTests)
 BOOST_AUTO_TEST_CASE(testExtrapolateDataZerothOrder)
 {
@@ -77,6 +77,20 @@ void Parallel::CommState::synchronize() const
 #endif // not PRECICE_NO_MPI
 }
 
+void Parallel::CommState::broadcast(std::string &buffer) const
+{
+#ifndef PRECICE_NO_MPI
+  PRECICE_TRACE(buffer.size());
+  if (isNull()) {
+    return;
+  }
+  unsigned long size = buffer.size();
+  MPI_Bcast(&size, 1, MPI_UNSIGNED_LONG, 0, comm);
+  buffer.resize(size);
+  MPI_Bcast(buffer.data(), static_cast<int>(size), MPI_CHAR, 0, comm);
+#endif // not PRECICE_NO_MPI
+}
+
 bool Parallel::CommState::isNull() const
 {
 #ifndef PRECICE_NO_MPI
@@ -187,6 +201,20 @@ bool Parallel::isMPIInitialized()
 #endif // not PRECICE_NO_MPI
 }
 
+bool Parallel::allowsConcurrentCalls()
+{
+#ifndef PRECICE_NO_MPI
+  if (!isMPIInitialized()) {
+    return true;
+  }
+  int provided{-1};
+  MPI_Query_thread(&provided);
+  return provided == MPI_THREAD_MULTIPLE;
+#else
+  return true;
+#endif // not PRECICE_NO_MPI
+}
+
 void Parallel::initializeOrDetectMPI(std::optional<Communicator> userProvided)
 {
 #ifndef PRECICE_NO_MPI
@@ -248,11 +276,17 @@ void Parallel::finalizeOrCleanupMPI()
 
 void Parallel::initializeTestingMPI(
     int *   argc,
-    char ***argv)
+    char ***argv,
+    bool    threadMultiple)
 {
 #ifndef PRECICE_NO_MPI
   PRECICE_ASSERT(!isMPIInitialized(), "MPI was already initialized.");
-  MPI_Init(argc, argv);
+  if (threadMultiple) {
+    int provided;
+    MPI_Init_thread(argc, argv, MPI_THREAD_MULTIPLE, &provided);
+  } else {
+    MPI_Init(argc, argv);
+  }
   // By altering the commstate, preCICE will know that it is testing mode
   _currentState = CommState::world();
 #endif // not PRECICE_NO_MPI
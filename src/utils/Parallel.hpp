@@ -110,6 +110,11 @@ public:
      */
     void synchronize() const;
 
+    /** Broadcasts a buffer from rank 0 to all processes in the communicator
+     * @attention This is a collective operation and has to be called by every rank in the communicator comm!
+     */
+    void broadcast(std::string &buffer) const;
+
     /// pretty printer for comms
     void print(std::ostream &out) const;
 
@@ -156,10 +161,14 @@ public:
    *
    * @param[in] argc Parameter count
    * @param[in] argv Parameter values, is passed to MPI_Init
+   * @param[in] threadMultiple request MPI_THREAD_MULTIPLE, which the MPI implementation may not provide
+   *
+   * @see allowsConcurrentCalls() to check the provided thread support
    */
   static void initializeTestingMPI(
       int *   argc,
-      char ***argv);
+      char ***argv,
+      bool    threadMultiple = false);
 
   /// Unconditionally finalizes MPI environment.
   static void finalizeTestingMPI();
@@ -212,6 +221,13 @@ public:
   /// Returns an owning pointer to the current CommState.
   static CommStatePtr current();
 
+  /** Returns true if preCICE may call MPI from a separate thread.
+   *
+   * This requires MPI to provide MPI_THREAD_MULTIPLE, as the solver may still call MPI concurrently.
+   * Without MPI, this is always true.
+   */
+  static bool allowsConcurrentCalls();
+
   /// @}
 
 private:
@@ -1,7 +1,9 @@
 #include <algorithm>
 #include <cstddef>
+#include <cstring>
 #include <exception>
 #include <fstream>
+#include <functional>
 #include <iterator>
 #include <libxml/SAX.h>
 #include <memory>
@@ -12,7 +14,9 @@
 
 #include "logging/LogMacros.hpp"
 #include "logging/Logger.hpp"
+#include "utils/Parallel.hpp"
 #include "utils/String.hpp"
+#include "utils/assertion.hpp"
 #include "xml/ConfigParser.hpp"
 #include "xml/XMLTag.hpp"
 
@@ -122,7 +126,13 @@ precice::logging::Logger ConfigParser::_log("xml::XMLParser");
 ConfigParser::ConfigParser(std::string_view filePath, const ConfigurationContext &context, std::shared_ptr<precice::xml::XMLTag> pXmlTag)
     : m_pXmlTag(std::move(pXmlTag))
 {
-  readXmlFile(std::string(filePath));
+  // The ranks of a participant share the tags read by the primary rank
+  if (const auto &comm = *utils::Parallel::current();
+      context.size > 1 && comm.size() == context.size && comm.rank() == context.rank) {
+    readAndShareXmlFile(std::string(filePath));
+  } else {
+    readXmlFile(std::string(filePath));
+  }
 
   std::vector<std::shared_ptr<XMLTag>> DefTags{m_pXmlTag};
   CTagPtrVec                           SubTags;
@@ -188,6 +198,132 @@ int ConfigParser::readXmlFile(std::string const &filePath)
   return 0;
 }
 
+void ConfigParser::readAndShareXmlFile(std::string const &filePath)
+{
+  const auto &comm = *utils::Parallel::current();
+  std::string buffer;
+  if (comm.rank() == 0) {
+    try {
+      readXmlFile(filePath);
+    } catch (const ::precice::Error &) {
+      // An empty buffer tells the secondary ranks to stop waiting for the tags
+      comm.broadcast(buffer);
+      throw;
+    }
+    buffer = serializeTags();
+    comm.broadcast(buffer);
+  } else {
+    comm.broadcast(buffer);
+    PRECICE_CHECK(!buffer.empty(),
+                  "The primary rank was unable to read the configuration file \"{}\". "
+                  "Please check its output for the reason.",
+                  filePath);
+    deserializeTags(buffer);
+  }
+}
+
+namespace {
+/// Appends the given value in its binary representation
+template <typename T>
+void appendBinary(std::string &buffer, T value)
+{
+  buffer.append(reinterpret_cast<const char *>(&value), sizeof(T));
+}
+
+void appendString(std::string &buffer, std::string_view str)
+{
+  appendBinary(buffer, str.size());
+  buffer.append(str);
+}
+
+void appendTag(std::string &buffer, const ConfigParser::CTag &tag)
+{
+  appendString(buffer, tag.m_Prefix);
+  appendString(buffer, tag.m_Name);
+  appendBinary(buffer, tag.m_aAttributes.size());
+  for (const auto &[key, value] : tag.m_aAttributes) {
+    appendString(buffer, key);
+    appendString(buffer, value);
+  }
+  appendBinary(buffer, tag.m_aSubTags.size());
+  for (const auto &subtag : tag.m_aSubTags) {
+    appendTag(buffer, *subtag);
+  }
+}
+
+/// Reads values from a buffer in the order they were appended
+class BufferReader {
+public:
+  explicit BufferReader(std::string_view buffer)
+      : _buffer(buffer) {}
+
+  template <typename T>
+  T readBinary()
+  {
+    PRECICE_ASSERT(_position + sizeof(T) <= _buffer.size());
+    T value;
+    std::memcpy(&value, _buffer.data() + _position, sizeof(T));
+    _position += sizeof(T);
+    return value;
+  }
+
+  std::string readString()
+  {
+    const auto size = readBinary<std::size_t>();
+    PRECICE_ASSERT(_position + size <= _buffer.size());
+    std::string str{_buffer.substr(_position, size)};
+    _position += size;
+    return str;
+  }
+
+private:
+  std::string_view _buffer;
+  std::size_t      _position = 0;
+};
+} // namespace
+
+std::string ConfigParser::serializeTags() const
+{
+  // Only the root tag is connected, its subtags are reachable from it
+  std::string buffer;
+  appendBinary(buffer, static_cast<std::size_t>(m_AllTags.empty() ? 0 : 1));
+  if (not m_AllTags.empty()) {
+    appendTag(buffer, *m_AllTags.front());
+  }
+  return buffer;
+}
+
+void ConfigParser::deserializeTags(std::string_view buffer)
+{
+  BufferReader reader(buffer);
+  const auto   roots = reader.readBinary<std::size_t>();
+  PRECICE_ASSERT(roots <= 1);
+  if (roots == 0) {
+    return;
+  }
+
+  // Replays the callbacks of the xml parser
+  std::function<void()> readTag = [&]() {
+    auto prefix = reader.readString();
+    auto name   = reader.readString();
+
+    CTag::AttributePair attributes;
+    const auto          nAttributes = reader.readBinary<std::size_t>();
+    for (std::size_t i = 0; i < nAttributes; ++i) {
+      auto key        = reader.readString();
+      attributes[key] = reader.readString();
+    }
+    OnStartElement(name, prefix, std::move(attributes));
+
+    const auto nSubTags = reader.readBinary<std::size_t>();
+    for (std::size_t i = 0; i < nSubTags; ++i) {
+      readTag();
+    }
+    OnEndElement();
+  };
+  readTag();
+}
+
 namespace {
 struct Distance {
   std::size_t distance;
@@ -3,6 +3,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <string_view>
 #include <vector>
 #include "logging/Logger.hpp"
 #include "xml/XMLTag.hpp"
@@ -52,6 +53,21 @@ public:
   /// Reads the xml file
   int readXmlFile(std::string const &filePath);
 
+  /**
+   * @brief Reads the xml file on the primary rank and shares the read tags with the secondary ranks
+   *
+   * This prevents all ranks of a participant from accessing the file system at once.
+   *
+   * @attention This is a collective operation on the current communicator of utils::Parallel
+   */
+  void readAndShareXmlFile(std::string const &filePath);
+
+  /// Serializes the tags read from the xml file into a compact buffer
+  std::string serializeTags() const;
+
+  /// Restores the tags from a buffer created by serializeTags()
+  void deserializeTags(std::string_view buffer);
+
   /**
    * @brief Connects the actual tags of an xml layer with the predefined tags
    * @param DefTags predefined tags
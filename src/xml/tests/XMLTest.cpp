@@ -69,4 +69,36 @@ BOOST_AUTO_TEST_CASE(VectorAttributes)
   BOOST_TEST(cb.eigenVectorXd(2) == 1.0);
 }
 
+BOOST_AUTO_TEST_CASE(SharedConfiguration)
+{
+  PRECICE_TEST(2_ranks);
+  std::string filename(getPathToSources() + "/xml/tests/config_xmltest_vectorattributes.xml");
+
+  CallbackHost cb;
+  XMLTag       rootTag(cb, "configuration", XMLTag::OCCUR_ONCE);
+  XMLTag       testTagEigenXd(cb, "test-eigen-vectorxd-attributes", XMLTag::OCCUR_ONCE);
+
+  XMLAttribute<Eigen::VectorXd> attrEigenXd("value");
+  testTagEigenXd.addAttribute(attrEigenXd);
+  rootTag.addSubtag(testTagEigenXd);
+
+  // Only the primary rank reads the file
+  configure(rootTag, ConfigurationContext{"", context.rank, context.size}, filename);
+  BOOST_TEST(cb.eigenVectorXd.size() == 3);
+  BOOST_TEST(cb.eigenVectorXd(0) == 3.0);
+  BOOST_TEST(cb.eigenVectorXd(1) == 2.0);
+  BOOST_TEST(cb.eigenVectorXd(2) == 1.0);
+}
+
+BOOST_AUTO_TEST_CASE(SharedConfigurationMissingFile)
+{
+  PRECICE_TEST(2_ranks);
+
+  CallbackHost cb;
+  XMLTag       rootTag(cb, "configuration", XMLTag::OCCUR_ONCE);
+
+  // All ranks fail if the primary rank cannot read the file
+  BOOST_CHECK_THROW(configure(rootTag, ConfigurationContext{"", context.rank, context.size}, "missing-configuration.xml"), ::precice::Error);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,100 @@
+#ifndef PRECICE_NO_MPI
+
+#include "testing/Testing.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <precice/precice.hpp>
+#include <vector>
+
+namespace {
+
+/// Runs a fixed-point problem whose solution changes in every time window and returns the values read in all iterations
+std::vector<double> runChangingFixedPoint(std::string const &config, precice::testing::TestContext const &context, MPI_Comm comm)
+{
+  const bool        isFirst       = context.isNamed("SolverOne");
+  const std::string meshName      = isFirst ? "MeshOne" : "MeshTwo";
+  const std::string writeDataName = isFirst ? "Data11" : "Data21";
+  const std::string readDataName  = isFirst ? "Data21" : "Data11";
+
+  precice::Participant participant(context.name, config, context.rank, context.size, &comm);
+
+  double   positions[8] = {1.0, 0.0, 1.0, 0.5, 1.0, 1.0, 1.0, 1.5};
+  VertexID vertexIDs[4];
+  participant.setMeshVertices(meshName, positions, vertexIDs);
+  participant.initialize();
+
+  double              inValues[4]  = {0.0, 0.0, 0.0, 0.0};
+  double              outValues[4] = {0.0, 0.0, 0.0, 0.0};
+  std::vector<double> history;
+  int                 timeWindow = 0;
+
+  while (participant.isCouplingOngoing()) {
+    if (participant.requiresWritingCheckpoint()) {
+    }
+
+    double preciceDt = participant.getMaxTimeStepSize();
+    participant.readData(meshName, readDataName, vertexIDs, preciceDt, inValues);
+    history.insert(history.end(), std::begin(inValues), std::end(inValues));
+
+    if (isFirst) {
+      std::copy(std::begin(inValues), std::end(inValues), std::begin(outValues));
+    } else {
+      // Same equations as in runTestQN, the solution (-sqrt(c), 0, -sqrt(c), -sqrt(c)) moves with the time window
+      const double c = 4.0 + timeWindow;
+      outValues[0]   = 2 * inValues[0] * inValues[0] - inValues[1] * inValues[2] - 2.0 * c + inValues[0];
+      outValues[1]   = inValues[0] * inValues[0] * inValues[1] + 2.0 * inValues[0] * inValues[1] * inValues[2] + inValues[1] * inValues[2] * inValues[2] + inValues[1];
+      outValues[2]   = inValues[2] * inValues[2] - c + inValues[2];
+      outValues[3]   = inValues[3] * inValues[3] - c + inValues[3];
+    }
+
+    participant.writeData(meshName, writeDataName, vertexIDs, outValues);
+    participant.advance(preciceDt);
+
+    if (participant.requiresReadingCheckpoint()) {
+    }
+    if (participant.isTimeWindowComplete()) {
+      ++timeWindow;
+    }
+  }
+
+  participant.finalize();
+  BOOST_TEST(timeWindow == 4);
+  return history;
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(Integration)
+BOOST_AUTO_TEST_SUITE(QuasiNewton)
+BOOST_AUTO_TEST_SUITE(Serial)
+BOOST_AUTO_TEST_CASE(TestQN11NoRestart)
+{
+  PRECICE_TEST("SolverOne"_on(1_rank), "SolverTwo"_on(1_rank));
+  // serial coupling, IQN-IMVJ acceleration, the `low-rank` representation of TestQN11 keeps all time windows
+  // beyond its chunk-size and, thus, has to reproduce the iterations of `no-restart`
+  // Both runs use a user-defined communicator, as finalizing a participant resets the communicator of the test
+  MPI_Comm comm;
+  MPI_Comm_dup(precice::utils::Parallel::current()->comm, &comm);
+  const auto noRestart = runChangingFixedPoint(context.config(), context, comm);
+  const auto lowRank   = runChangingFixedPoint(context.prefix("TestQN11.xml"), context, comm);
+  MPI_Comm_free(&comm);
+
+  BOOST_TEST_REQUIRE(lowRank.size() == noRestart.size());
+  for (std::size_t i = 0; i < lowRank.size(); ++i) {
+    BOOST_TEST(testing::equals(lowRank[i], noRestart[i], 1e-8));
+  }
+
+  // the last time window converged to the solution for c = 7
+  if (context.isNamed("SolverTwo")) {
+    BOOST_TEST(lowRank[lowRank.size() - 4] == -std::sqrt(7.0), boost::test_tools::tolerance(1e-5));
+    BOOST_TEST(testing::equals(lowRank[lowRank.size() - 3], 0.0, 1e-5));
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Integration
+BOOST_AUTO_TEST_SUITE_END() // QuasiNewton
+BOOST_AUTO_TEST_SUITE_END() // Serial
+
+#endif // PRECICE_NO_MPI
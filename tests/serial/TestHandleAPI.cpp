@@ -0,0 +1,81 @@
+#ifndef PRECICE_NO_MPI
+
+#include "testing/Testing.hpp"
+
+#include <precice/precice.hpp>
+#include <type_traits>
+#include <vector>
+
+// Handles are strong types, which neither convert to each other nor to integers
+static_assert(!std::is_convertible_v<precice::MeshHandle, int>);
+static_assert(!std::is_convertible_v<int, precice::MeshHandle>);
+static_assert(!std::is_convertible_v<precice::DataHandle, int>);
+static_assert(!std::is_convertible_v<int, precice::DataHandle>);
+static_assert(!std::is_convertible_v<precice::MeshHandle, precice::DataHandle>);
+static_assert(!std::is_convertible_v<precice::DataHandle, precice::MeshHandle>);
+
+BOOST_AUTO_TEST_SUITE(Integration)
+BOOST_AUTO_TEST_SUITE(Serial)
+/**
+ * @brief Tests the handle-based overloads of the mesh and data access API functions
+ */
+BOOST_AUTO_TEST_CASE(TestHandleAPI)
+{
+  PRECICE_TEST("SolverOne"_on(1_rank), "SolverTwo"_on(1_rank));
+
+  precice::Participant participant(context.name, context.config(), 0, 1);
+  if (context.isNamed("SolverOne")) {
+    const auto meshHandle  = participant.getMeshHandle("MeshOne");
+    const auto writeHandle = participant.getDataHandle("MeshOne", "DataOne");
+    const auto readHandle  = participant.getDataHandle("MeshOne", "DataTwo");
+    BOOST_TEST((meshHandle == participant.getMeshHandle("MeshOne")));
+    BOOST_TEST((writeHandle != readHandle));
+    BOOST_TEST(participant.getMeshDimensions(meshHandle) == 3);
+    BOOST_TEST(participant.getDataDimensions(writeHandle) == 3);
+    BOOST_TEST(participant.getDataDimensions(readHandle) == 1);
+
+    std::vector<double> positions{0.0, 0.0, 0.0, 1.0, 0.0, 0.0};
+    std::vector<int>    ids(2);
+    participant.setMeshVertices(meshHandle, positions, ids);
+
+    // Handles do not allow to bypass the data access configured for this participant
+    std::vector<double> readValues(2);
+    BOOST_CHECK_THROW(participant.writeData(readHandle, ids, readValues), ::precice::Error);
+    BOOST_CHECK_THROW(participant.writeData(precice::DataHandle{42}, ids, readValues), ::precice::Error);
+
+    participant.initialize();
+    const std::vector<double> writeValues(6, 7.0);
+    while (participant.isCouplingOngoing()) {
+      participant.writeData(writeHandle, ids, writeValues);
+      participant.advance(participant.getMaxTimeStepSize());
+      if (participant.isCouplingOngoing()) {
+        participant.readData(readHandle, ids, participant.getMaxTimeStepSize(), readValues);
+        BOOST_TEST(readValues == std::vector<double>(2, 14.0), boost::test_tools::per_element());
+      }
+    }
+  } else {
+    BOOST_TEST(context.isNamed("SolverTwo"));
+    auto meshName = "MeshTwo";
+
+    std::vector<double> positions{0.0, 0.0, 0.0, 1.0, 0.0, 0.0};
+    std::vector<int>    ids(2);
+    participant.setMeshVertices(meshName, positions, ids);
+
+    participant.initialize();
+    std::vector<double> readValues(6);
+    while (participant.isCouplingOngoing()) {
+      const double dt = participant.getMaxTimeStepSize();
+      participant.readData(meshName, "DataOne", ids, dt, readValues);
+      BOOST_TEST(readValues == std::vector<double>(6, 7.0), boost::test_tools::per_element());
+      const std::vector<double> writeValues{2 * readValues[0], 2 * readValues[3]};
+      participant.writeData(meshName, "DataTwo", ids, writeValues);
+      participant.advance(dt);
+    }
+  }
+  participant.finalize();
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Integration
+BOOST_AUTO_TEST_SUITE_END() // Serial
+
+#endif // PRECICE_NO_MPI
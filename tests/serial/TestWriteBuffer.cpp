@@ -0,0 +1,79 @@
+#ifndef PRECICE_NO_MPI
+
+#include "testing/Testing.hpp"
+
+#include <algorithm>
+#include <precice/precice.hpp>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(Integration)
+BOOST_AUTO_TEST_SUITE(Serial)
+/**
+ * @brief Tests writing data directly into the write buffer of preCICE
+ */
+BOOST_AUTO_TEST_CASE(TestWriteBuffer)
+{
+  PRECICE_TEST("SolverOne"_on(1_rank), "SolverTwo"_on(1_rank));
+
+  precice::Participant participant(context.name, context.config(), 0, 1);
+  if (context.isNamed("SolverOne")) {
+    auto meshName = "MeshOne";
+
+    std::vector<double> positions{0.0, 0.0, 0.0, 1.0, 0.0, 0.0};
+    std::vector<int>    ids(2);
+    participant.setMeshVertices(meshName, positions, ids);
+
+    // Read data cannot be written
+    BOOST_CHECK_THROW(participant.getWriteBuffer(meshName, "DataTwo"), ::precice::Error);
+    BOOST_CHECK_THROW(participant.getWriteBuffer(participant.getDataHandle(meshName, "DataTwo")), ::precice::Error);
+
+    participant.initialize();
+    const auto          writeHandle = participant.getDataHandle(meshName, "DataOne");
+    std::vector<double> readValues(2);
+    int                 step = 0;
+    while (participant.isCouplingOngoing()) {
+      auto buffer = (step % 2 == 0) ? participant.getWriteBuffer(meshName, "DataOne") : participant.getWriteBuffer(writeHandle);
+      BOOST_TEST(buffer.size() == 6);
+      // The buffer is reset after every advance
+      BOOST_TEST(std::all_of(buffer.begin(), buffer.end(), [](double v) { return v == 0.0; }));
+      for (int i = 0; i < 3; ++i) {
+        buffer[ids[0] * 3 + i] = step;
+        buffer[ids[1] * 3 + i] = 10 + step;
+      }
+      participant.advance(participant.getMaxTimeStepSize());
+      if (participant.isCouplingOngoing()) {
+        participant.readData(meshName, "DataTwo", ids, participant.getMaxTimeStepSize(), readValues);
+        BOOST_TEST(readValues[0] == 2.0 * step);
+        BOOST_TEST(readValues[1] == 2.0 * (10 + step));
+      }
+      ++step;
+    }
+  } else {
+    BOOST_TEST(context.isNamed("SolverTwo"));
+    auto meshName = "MeshTwo";
+
+    std::vector<double> positions{0.0, 0.0, 0.0, 1.0, 0.0, 0.0};
+    std::vector<int>    ids(2);
+    participant.setMeshVertices(meshName, positions, ids);
+
+    participant.initialize();
+    std::vector<double> readValues(6);
+    int                 step = 0;
+    while (participant.isCouplingOngoing()) {
+      const double dt = participant.getMaxTimeStepSize();
+      participant.readData(meshName, "DataOne", ids, dt, readValues);
+      const std::vector<double> expected{1.0 * step, 1.0 * step, 1.0 * step, 10.0 + step, 10.0 + step, 10.0 + step};
+      BOOST_TEST(readValues == expected, boost::test_tools::per_element());
+      const std::vector<double> writeValues{2 * readValues[0], 2 * readValues[3]};
+      participant.writeData(meshName, "DataTwo", ids, writeValues);
+      participant.advance(dt);
+      ++step;
+    }
+  }
+  participant.finalize();
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Integration
+BOOST_AUTO_TEST_SUITE_END() // Serial
+
+#endif // PRECICE_NO_MPI
@@ -0,0 +1,24 @@
+#ifndef PRECICE_NO_MPI
+
+#include "helpers.hpp"
+#include "testing/Testing.hpp"
+
+BOOST_AUTO_TEST_SUITE(Integration)
+BOOST_AUTO_TEST_SUITE(Serial)
+BOOST_AUTO_TEST_SUITE(AsyncAdvance)
+/**
+ * @brief Tests the asynchronous advance with the thread support of the test suite
+ *
+ * The test suite does not request MPI_THREAD_MULTIPLE, hence, waitAdvance() usually completes the advance.
+ */
+BOOST_AUTO_TEST_CASE(TestAsyncAdvance)
+{
+  PRECICE_TEST("SolverOne"_on(1_rank), "SolverTwo"_on(1_rank));
+  runTestAsyncAdvance(context.config(), context);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // AsyncAdvance
+BOOST_AUTO_TEST_SUITE_END() // Serial
+BOOST_AUTO_TEST_SUITE_END() // Integration
+
+#endif // PRECICE_NO_MPI
@@ -0,0 +1,35 @@
+#ifndef PRECICE_NO_MPI
+
+#include "helpers.hpp"
+#include "testing/Testing.hpp"
+#include "utils/Parallel.hpp"
+
+namespace {
+/// The coupling is only completed in the background if MPI provides MPI_THREAD_MULTIPLE
+boost::test_tools::assertion_result allowsConcurrentCalls(boost::unit_test::test_unit_id)
+{
+  boost::test_tools::assertion_result result{precice::utils::Parallel::allowsConcurrentCalls()};
+  result.message() << "MPI does not provide MPI_THREAD_MULTIPLE, run the test suite with --mpi-thread-multiple";
+  return result;
+}
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(Integration)
+BOOST_AUTO_TEST_SUITE(Serial)
+BOOST_AUTO_TEST_SUITE(AsyncAdvance)
+/**
+ * @brief Tests the asynchronous advance, which completes the coupling in a separate thread
+ *
+ * The test is skipped unless the test suite requested MPI_THREAD_MULTIPLE and MPI provides it.
+ */
+BOOST_AUTO_TEST_CASE(TestAsyncAdvanceThreaded, *boost::unit_test::precondition(allowsConcurrentCalls))
+{
+  PRECICE_TEST("SolverOne"_on(1_rank), "SolverTwo"_on(1_rank));
+  runTestAsyncAdvance(context.config(), context);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // AsyncAdvance
+BOOST_AUTO_TEST_SUITE_END() // Serial
+BOOST_AUTO_TEST_SUITE_END() // Integration
+
+#endif // PRECICE_NO_MPI
@@ -0,0 +1,77 @@
+#ifndef PRECICE_NO_MPI
+
+#include "helpers.hpp"
+#include "testing/Testing.hpp"
+
+#include <vector>
+#include "precice/precice.hpp"
+
+/**
+ * @brief Advances with startAdvance() and waitAdvance() including mappings on both participants
+ */
+void runTestAsyncAdvance(std::string const &config, TestContext const &context)
+{
+  precice::Participant participant(context.name, config, 0, 1);
+  if (context.isNamed("SolverOne")) {
+    auto meshName = "MeshOne";
+
+    std::vector<double> positions{0.0, 0.0, 0.0, 1.0, 0.0, 0.0};
+    std::vector<int>    ids(2);
+    participant.setMeshVertices(meshName, positions, ids);
+    const auto meshHandle = participant.getMeshHandle(meshName);
+
+    // There is no pending advance to wait for
+    BOOST_CHECK_THROW(participant.waitAdvance(), ::precice::Error);
+
+    participant.initialize();
+    std::vector<double> readValues(2);
+    int                 step = 0;
+    while (participant.isCouplingOngoing()) {
+      const std::vector<double> writeValues{1.0 * step, 1.0 * step, 1.0 * step, 10.0 + step, 10.0 + step, 10.0 + step};
+      participant.writeData(meshName, "DataOne", ids, writeValues);
+      participant.startAdvance(participant.getMaxTimeStepSize());
+
+      // Only queries of the configuration are allowed while the advance is pending
+      BOOST_TEST(participant.getMeshDimensions(meshName) == 3);
+      BOOST_TEST(participant.getDataDimensions(meshName, "DataOne") == 3);
+      BOOST_CHECK_THROW(participant.isCouplingOngoing(), ::precice::Error);
+      BOOST_CHECK_THROW(participant.writeData(meshName, "DataOne", ids, writeValues), ::precice::Error);
+      BOOST_CHECK_THROW(participant.setMeshVertices(meshHandle, positions, ids), ::precice::Error);
+      BOOST_CHECK_THROW(participant.readData(meshName, "DataTwo", ids, 0.0, readValues), ::precice::Error);
+      BOOST_CHECK_THROW(participant.startAdvance(1.0), ::precice::Error);
+      participant.waitAdvance();
+
+      if (participant.isCouplingOngoing()) {
+        participant.readData(meshName, "DataTwo", ids, participant.getMaxTimeStepSize(), readValues);
+        BOOST_TEST(readValues[0] == 2.0 * step);
+        BOOST_TEST(readValues[1] == 2.0 * (10 + step));
+      }
+      ++step;
+    }
+  } else {
+    BOOST_TEST(context.isNamed("SolverTwo"));
+    auto meshName = "MeshTwo";
+
+    std::vector<double> positions{0.0, 0.0, 0.0, 1.0, 0.0, 0.0};
+    std::vector<int>    ids(2);
+    participant.setMeshVertices(meshName, positions, ids);
+
+    participant.initialize();
+    std::vector<double> readValues(6);
+    int                 step = 0;
+    while (participant.isCouplingOngoing()) {
+      const double dt = participant.getMaxTimeStepSize();
+      participant.readData(meshName, "DataOne", ids, dt, readValues);
+      const std::vector<double> expected{1.0 * step, 1.0 * step, 1.0 * step, 10.0 + step, 10.0 + step, 10.0 + step};
+      BOOST_TEST(readValues == expected, boost::test_tools::per_element());
+      const std::vector<double> writeValues{2 * readValues[0], 2 * readValues[3]};
+      participant.writeData(meshName, "DataTwo", ids, writeValues);
+      participant.startAdvance(dt);
+      participant.waitAdvance();
+      ++step;
+    }
+  }
+  participant.finalize();
+}
+
+#endif
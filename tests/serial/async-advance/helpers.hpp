@@ -0,0 +1,12 @@
+#ifndef PRECICE_NO_MPI
+
+#pragma once
+
+#include "testing/TestContext.hpp"
+
+using namespace precice;
+using precice::testing::TestContext;
+
+void runTestAsyncAdvance(std::string const &config, TestContext const &context);
+
+#endif
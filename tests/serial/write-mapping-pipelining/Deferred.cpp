@@ -0,0 +1,23 @@
+#ifndef PRECICE_NO_MPI
+
+#include "helper.hpp"
+#include "testing/Testing.hpp"
+
+#include <precice/precice.hpp>
+
+BOOST_AUTO_TEST_SUITE(Integration)
+BOOST_AUTO_TEST_SUITE(Serial)
+BOOST_AUTO_TEST_SUITE(WriteMappingPipelining)
+
+/// The write mappings of an explicit scheme are deferred until the data is sent
+BOOST_AUTO_TEST_CASE(Deferred)
+{
+  PRECICE_TEST("One"_on(1_rank), "Two"_on(1_rank));
+  runWriteMappingPipelining(context);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // WriteMappingPipelining
+BOOST_AUTO_TEST_SUITE_END() // Serial
+BOOST_AUTO_TEST_SUITE_END() // Integration
+
+#endif // PRECICE_NO_MPI
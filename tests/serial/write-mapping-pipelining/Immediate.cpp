@@ -0,0 +1,35 @@
+#ifndef PRECICE_NO_MPI
+
+#include "helper.hpp"
+#include "testing/Testing.hpp"
+
+#include <action/RecorderAction.hpp>
+#include <precice/precice.hpp>
+
+BOOST_AUTO_TEST_SUITE(Integration)
+BOOST_AUTO_TEST_SUITE(Serial)
+BOOST_AUTO_TEST_SUITE(WriteMappingPipelining)
+
+/// Actions after the write mappings require to map all data before any data is sent
+BOOST_AUTO_TEST_CASE(Immediate)
+{
+  PRECICE_TEST("One"_on(1_rank), "Two"_on(1_rank));
+  using precice::action::RecorderAction;
+
+  RecorderAction::reset();
+  runWriteMappingPipelining(context);
+
+  if (context.isNamed("One")) {
+    // The actions are performed in initialize and in each of the three time windows
+    BOOST_TEST(RecorderAction::records.size() == 4);
+    for (const auto &record : RecorderAction::records) {
+      BOOST_TEST(record.timing == precice::action::Action::WRITE_MAPPING_POST);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END() // WriteMappingPipelining
+BOOST_AUTO_TEST_SUITE_END() // Serial
+BOOST_AUTO_TEST_SUITE_END() // Integration
+
+#endif // PRECICE_NO_MPI
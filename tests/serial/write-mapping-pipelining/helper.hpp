@@ -0,0 +1,54 @@
+#pragma once
+
+#include <vector>
+
+#include "precice/impl/ParticipantImpl.hpp"
+#include "testing/Testing.hpp"
+
+// Coupling is One - Two in a serial-explicit scheme.
+// One writes two data, which are mapped to the received mesh of Two and then sent.
+// The tests choose whether the write mappings are deferred until each data is sent or executed before the exchange.
+
+inline void runWriteMappingPipelining(precice::testing::TestContext &context)
+{
+  precice::Participant participant(context.name, context.config(), context.rank, context.size);
+
+  std::vector<double>            coords{0, 0, 1, 1};
+  std::vector<precice::VertexID> vertexIDs(2);
+  std::string                    meshName = "Mesh" + context.name;
+  participant.setMeshVertices(meshName, coords, vertexIDs);
+
+  participant.initialize();
+
+  int timeWindow = 0;
+  while (participant.isCouplingOngoing()) {
+    BOOST_TEST_CONTEXT("TW = " << timeWindow)
+    {
+      const std::vector<double> expectedOne{1.0 + timeWindow, 2.0 + timeWindow};
+      const std::vector<double> expectedTwo{10.0 * timeWindow, 20.0 * timeWindow};
+      const double              dt = participant.getMaxTimeStepSize();
+
+      if (context.isNamed("One")) {
+        participant.writeData(meshName, "DataOne", vertexIDs, expectedOne);
+        participant.writeData(meshName, "DataTwo", vertexIDs, expectedTwo);
+        participant.advance(dt);
+
+        // Both data are mapped in every time window
+        auto mapped = precice::testing::WhiteboxAccessor::impl(participant).mappedSamples();
+        BOOST_TEST(mapped.write == 2);
+        BOOST_TEST(mapped.read == 0);
+      } else {
+        std::vector<double> valuesOne(2);
+        std::vector<double> valuesTwo(2);
+        participant.readData(meshName, "DataOne", vertexIDs, dt, valuesOne);
+        participant.readData(meshName, "DataTwo", vertexIDs, dt, valuesTwo);
+        BOOST_TEST(valuesOne == expectedOne, boost::test_tools::per_element());
+        BOOST_TEST(valuesTwo == expectedTwo, boost::test_tools::per_element());
+        participant.advance(dt);
+      }
+      ++timeWindow;
+    }
+  }
+
+  BOOST_TEST(timeWindow == 3);
+}
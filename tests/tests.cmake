@@ -64,6 +64,7 @@ target_sources(testprecice
     tests/quasi-newton/parallel/TestQN1.cpp
     tests/quasi-newton/parallel/TestQN10.cpp
     tests/quasi-newton/parallel/TestQN10EmptyPartition.cpp
+    tests/quasi-newton/parallel/TestQN11.cpp
     tests/quasi-newton/parallel/TestQN1EmptyPartition.cpp
     tests/quasi-newton/parallel/TestQN2.cpp
     tests/quasi-newton/parallel/TestQN2EmptyPartition.cpp
@@ -84,6 +85,8 @@ target_sources(testprecice
     tests/quasi-newton/serial/DefaultConfig.cpp
     tests/quasi-newton/serial/TestQN1.cpp
     tests/quasi-newton/serial/TestQN10.cpp
+    tests/quasi-newton/serial/TestQN11.cpp
+    tests/quasi-newton/serial/TestQN11NoRestart.cpp
     tests/quasi-newton/serial/TestQN2.cpp
     tests/quasi-newton/serial/TestQN3.cpp
     tests/quasi-newton/serial/TestQN4.cpp
@@ -99,12 +102,18 @@ target_sources(testprecice
     tests/serial/SummationActionTwoSources.cpp
     tests/serial/TestExplicitWithDataMultipleReadWrite.cpp
     tests/serial/TestExplicitWithSolverGeometry.cpp
+    tests/serial/TestHandleAPI.cpp
     tests/serial/TestImplicit.cpp
     tests/serial/TestReadAPI.cpp
+    tests/serial/TestWriteBuffer.cpp
     tests/serial/action-timings/ActionTimingsParallelExplicit.cpp
     tests/serial/action-timings/ActionTimingsParallelImplicit.cpp
     tests/serial/action-timings/ActionTimingsSerialExplicit.cpp
     tests/serial/action-timings/ActionTimingsSerialImplicit.cpp
+    tests/serial/async-advance/TestAsyncAdvance.cpp
+    tests/serial/async-advance/TestAsyncAdvanceThreaded.cpp
+    tests/serial/async-advance/helpers.cpp
+    tests/serial/async-advance/helpers.hpp
     tests/serial/circular/Explicit.cpp
     tests/serial/circular/helper.hpp
     tests/serial/compositional/OneActivatedMuscle.cpp
@@ -287,6 +296,7 @@ target_sources(testprecice
     tests/serial/time/explicit/serial-coupling/DoNothingWithSubcycling.cpp
     tests/serial/time/explicit/serial-coupling/ReadWriteScalarDataFirstParticipant.cpp
     tests/serial/time/explicit/serial-coupling/ReadWriteScalarDataFirstParticipantInitData.cpp
+    tests/serial/time/explicit/serial-coupling/ReadWriteScalarDataWithReducedSubsteps.cpp
     tests/serial/time/explicit/serial-coupling/ReadWriteScalarDataWithSubcycling.cpp
     tests/serial/time/explicit/serial-coupling/ReadWriteScalarDataWithSubcyclingNoSubsteps.cpp
     tests/serial/time/implicit/compositional/DoNothingWithSubcycling.cpp
@@ -323,6 +333,9 @@ target_sources(testprecice
     tests/serial/whitebox/TestConfigurationComsol.cpp
     tests/serial/whitebox/TestConfigurationPeano.cpp
     tests/serial/whitebox/TestExplicitWithDataScaling.cpp
+    tests/serial/write-mapping-pipelining/Deferred.cpp
+    tests/serial/write-mapping-pipelining/Immediate.cpp
+    tests/serial/write-mapping-pipelining/helper.hpp
     )
 
 # Contains the list of integration test suites